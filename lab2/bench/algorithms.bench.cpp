@@ -0,0 +1,114 @@
+#include "mylist/list.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <ranges>
+#include <vector>
+
+namespace
+{
+
+constexpr auto elementCount = 1 << 16;
+
+auto makeSource() -> mylist::List<int>
+{
+    auto ls = mylist::List<int>();
+    for (int i = 0; i < elementCount; ++i)
+    {
+        ls.pushTail(i / 2);
+    }
+    return ls;
+}
+
+auto isEven = [](int element) { return element % 2 == 0; };
+
+// Копии готовятся вне замера: меряется только сам алгоритм
+template<typename Fn>
+void measureInPlace(Catch::Benchmark::Chronometer meter, const mylist::List<int>& source, Fn fn)
+{
+    auto lists = std::vector<mylist::List<int>>(meter.runs(), source);
+    meter.measure([&](int run) { return fn(lists[run]); });
+}
+
+} // namespace
+
+TEST_CASE("In-place algorithms versus rebuilding", "[!benchmark]")
+{
+    const auto source = makeSource();
+
+    BENCHMARK_ADVANCED("removeIf")(Catch::Benchmark::Chronometer meter)
+    {
+        measureInPlace(meter, source, [](mylist::List<int>& ls) { return ls.removeIf(isEven); });
+    };
+
+    BENCHMARK_ADVANCED("views::filter rebuild")(Catch::Benchmark::Chronometer meter)
+    {
+        measureInPlace(meter, source, [](mylist::List<int>& ls) {
+            auto view = ls | std::views::filter([](int element) { return !isEven(element); });
+            ls = mylist::List<int>(view.begin(), view.end());
+            return ls.size();
+        });
+    };
+
+    BENCHMARK_ADVANCED("unique")(Catch::Benchmark::Chronometer meter)
+    {
+        measureInPlace(meter, source, [](mylist::List<int>& ls) { return ls.unique(); });
+    };
+
+    BENCHMARK_ADVANCED("unique rebuild")(Catch::Benchmark::Chronometer meter)
+    {
+        measureInPlace(meter, source, [](mylist::List<int>& ls) {
+            auto result = mylist::List<int>();
+            for (auto element : ls)
+            {
+                if (result.empty() || result.peekTail() != element)
+                {
+                    result.pushTail(element);
+                }
+            }
+            ls = std::move(result);
+            return ls.size();
+        });
+    };
+
+    BENCHMARK_ADVANCED("reverse")(Catch::Benchmark::Chronometer meter)
+    {
+        measureInPlace(meter, source, [](mylist::List<int>& ls) {
+            ls.reverse();
+            return ls.size();
+        });
+    };
+
+    BENCHMARK_ADVANCED("reverse rebuild")(Catch::Benchmark::Chronometer meter)
+    {
+        measureInPlace(meter, source, [](mylist::List<int>& ls) {
+            ls = mylist::List<int>(ls.rbegin(), ls.rend());
+            return ls.size();
+        });
+    };
+
+    BENCHMARK_ADVANCED("partition")(Catch::Benchmark::Chronometer meter)
+    {
+        measureInPlace(meter, source, [](mylist::List<int>& ls) {
+            ls.partition(isEven);
+            return ls.size();
+        });
+    };
+
+    BENCHMARK_ADVANCED("partition rebuild")(Catch::Benchmark::Chronometer meter)
+    {
+        measureInPlace(meter, source, [](mylist::List<int>& ls) {
+            auto result = mylist::List<int>();
+            for (auto element : ls | std::views::filter(isEven))
+            {
+                result.pushTail(element);
+            }
+            for (auto element : ls | std::views::filter([](int element) { return !isEven(element); }))
+            {
+                result.pushTail(element);
+            }
+            ls = std::move(result);
+            return ls.size();
+        });
+    };
+}
@@ -0,0 +1,50 @@
+#include "mylist/list.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <numeric>
+
+namespace
+{
+
+constexpr auto elementCount = std::size_t{1} << 18;
+
+auto makeFragmented() -> mylist::List<long>
+{
+    auto ls = mylist::List<long>{0};
+    auto middle = ls.cend();
+    for (std::size_t i = 1; i < elementCount; ++i)
+    {
+        ls.insertBefore(middle, static_cast<long>(i));
+        if (i % 2 == 0)
+        {
+            --middle;
+        }
+    }
+    return ls;
+}
+
+} // namespace
+
+TEST_CASE("Traversal before and after compact()", "[!benchmark]")
+{
+    auto fragmented = makeFragmented();
+    auto compacted = makeFragmented();
+    compacted.compact();
+
+    BENCHMARK("fragmented")
+    {
+        return std::accumulate(fragmented.begin(), fragmented.end(), 0L);
+    };
+
+    BENCHMARK("compacted")
+    {
+        return std::accumulate(compacted.begin(), compacted.end(), 0L);
+    };
+
+    BENCHMARK("compact()")
+    {
+        fragmented.compact();
+        return fragmented.size();
+    };
+}
@@ -0,0 +1,95 @@
+#include "mylist/compressed_list.hpp"
+#include "mylist/list.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <random>
+
+namespace
+{
+
+constexpr auto elementCount = 1'000'000;
+
+// Считает байты, которые список берёт у ресурса
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    std::size_t bytes{};
+
+private:
+    auto do_allocate(std::size_t size, std::size_t alignment) -> void* override
+    {
+        bytes += size;
+        return std::pmr::new_delete_resource()->allocate(size, alignment);
+    }
+
+    void do_deallocate(void* pointer, std::size_t size, std::size_t alignment) override
+    {
+        bytes -= size;
+        std::pmr::new_delete_resource()->deallocate(pointer, size, alignment);
+    }
+
+    auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override
+    {
+        return this == &other;
+    }
+};
+
+} // namespace
+
+TEST_CASE("Compressed storage of increasing identifiers", "[!benchmark]")
+{
+    // В основном возрастающие идентификаторы с небольшими шагами
+    auto random = std::mt19937(42);
+    auto step = std::geometric_distribution<std::int64_t>(0.1);
+    auto counting = CountingResource();
+    auto ls = mylist::pmr::List<std::int64_t>(&counting);
+    auto compressed = mylist::CompressedList<std::int64_t>();
+    for (std::int64_t id = 1'000'000'000'000; compressed.size() < elementCount; id += 1 + step(random))
+    {
+        ls.pushTail(id);
+        compressed.pushTail(id);
+    }
+
+    WARN("List: " << static_cast<double>(counting.bytes) / elementCount << " bytes per element, CompressedList: "
+                  << static_cast<double>(compressed.storageBytes()) / elementCount << " bytes per element");
+
+    BENCHMARK("List, iterate")
+    {
+        auto sum = std::int64_t{};
+        ls.forEach([&](std::int64_t value) { sum += value; });
+        return sum;
+    };
+
+    BENCHMARK("CompressedList, iterate")
+    {
+        auto sum = std::int64_t{};
+        for (auto value : compressed)
+        {
+            sum += value;
+        }
+        return sum;
+    };
+
+    BENCHMARK("CompressedList, reverse iterate")
+    {
+        auto sum = std::int64_t{};
+        for (auto it = compressed.crbegin(); it != compressed.crend(); ++it)
+        {
+            sum += *it;
+        }
+        return sum;
+    };
+
+    BENCHMARK("CompressedList, build")
+    {
+        auto built = mylist::CompressedList<std::int64_t>();
+        for (auto value : compressed)
+        {
+            built.pushTail(value);
+        }
+        return built.size();
+    };
+}
@@ -0,0 +1,84 @@
+#include "mylist/list.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr auto elementCount = std::size_t{1} << 16;
+
+template<typename T>
+auto makeLists(int count, const T& value) -> std::vector<mylist::List<T>>
+{
+    auto lists = std::vector<mylist::List<T>>();
+    lists.reserve(count);
+    for (int i = 0; i < count; ++i)
+    {
+        lists.emplace_back(elementCount, value);
+    }
+    return lists;
+}
+
+template<typename T>
+void benchmarkDrain(const T& value)
+{
+    BENCHMARK_ADVANCED("popHead one by one")(Catch::Benchmark::Chronometer meter)
+    {
+        auto lists = makeLists(meter.runs(), value);
+        auto out = std::vector<T>();
+        out.reserve(elementCount);
+        meter.measure([&](int run) {
+            out.clear();
+            while (auto element = lists[run].popHead())
+            {
+                out.push_back(std::move(*element));
+            }
+            return out.size();
+        });
+    };
+
+    for (auto batch : {std::size_t{1}, std::size_t{16}, std::size_t{256}, std::size_t{4096}})
+    {
+        BENCHMARK_ADVANCED("popHeadN batch " + std::to_string(batch))(Catch::Benchmark::Chronometer meter)
+        {
+            auto lists = makeLists(meter.runs(), value);
+            auto out = std::vector<T>();
+            out.reserve(elementCount);
+            meter.measure([&](int run) {
+                out.clear();
+                while (!lists[run].empty())
+                {
+                    lists[run].popHeadN(batch, std::back_inserter(out));
+                }
+                return out.size();
+            });
+        };
+    }
+
+    BENCHMARK_ADVANCED("drainTo")(Catch::Benchmark::Chronometer meter)
+    {
+        auto lists = makeLists(meter.runs(), value);
+        auto out = std::vector<T>();
+        out.reserve(elementCount);
+        meter.measure([&](int run) {
+            out.clear();
+            return lists[run].drainTo(out);
+        });
+    };
+}
+
+} // namespace
+
+TEST_CASE("Drain List<int>", "[!benchmark]")
+{
+    benchmarkDrain(42);
+}
+
+TEST_CASE("Drain List<std::string>", "[!benchmark]")
+{
+    benchmarkDrain(std::string(32, 'x'));
+}
@@ -0,0 +1,122 @@
+#include "mylist/epoch_list.hpp"
+#include "mylist/list.hpp"
+#include <atomic>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <mutex>
+#include <numeric>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+constexpr auto elementCount = 4096;
+constexpr auto readerCount = 3;
+
+// Писатель в фоне крутит pushTail/popHead, пока идут замеры
+template<typename Push, typename Pop>
+class Writer
+{
+public:
+    Writer(Push push, Pop pop)
+        : mThread([this, push, pop] {
+              for (int i = elementCount; !mStop.load(std::memory_order_relaxed); ++i)
+              {
+                  push(i);
+                  pop();
+              }
+          })
+    {
+    }
+
+    ~Writer()
+    {
+        mStop.store(true);
+        mThread.join();
+    }
+
+private:
+    std::atomic<bool> mStop{};
+    std::thread mThread;
+};
+
+// Несколько читателей одновременно обходят список
+template<typename Traverse>
+auto readConcurrently(Traverse traverse) -> long long
+{
+    auto sums = std::vector<long long>(readerCount);
+    auto readers = std::vector<std::thread>();
+    for (int i = 0; i < readerCount; ++i)
+    {
+        readers.emplace_back([&, i] { sums[i] = traverse(); });
+    }
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+    return std::accumulate(sums.begin(), sums.end(), 0LL);
+}
+
+} // namespace
+
+TEST_CASE("Readers with a concurrent writer", "[!benchmark]")
+{
+    SECTION("EpochList")
+    {
+        auto ls = mylist::EpochList<int>();
+        for (int i = 0; i < elementCount; ++i)
+        {
+            ls.pushTail(i);
+        }
+
+        auto writer = Writer([&](int value) { ls.pushTail(value); }, [&] { ls.popHead(); });
+
+        BENCHMARK("lock-free readers")
+        {
+            return readConcurrently([&] {
+                auto sum = 0LL;
+                for (auto value : ls.read())
+                {
+                    sum += value;
+                }
+                return sum;
+            });
+        };
+    }
+
+    SECTION("List with shared_mutex")
+    {
+        auto ls = mylist::List<int>();
+        auto mutex = std::shared_mutex();
+        for (int i = 0; i < elementCount; ++i)
+        {
+            ls.pushTail(i);
+        }
+
+        auto writer = Writer(
+            [&](int value) {
+                auto lock = std::unique_lock(mutex);
+                ls.pushTail(value);
+            },
+            [&] {
+                auto lock = std::unique_lock(mutex);
+                ls.popHead();
+            });
+
+        BENCHMARK("shared_mutex readers")
+        {
+            return readConcurrently([&] {
+                auto lock = std::shared_lock(mutex);
+                auto sum = 0LL;
+                for (auto value : std::as_const(ls))
+                {
+                    sum += value;
+                }
+                return sum;
+            });
+        };
+    }
+}
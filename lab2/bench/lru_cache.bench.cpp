@@ -0,0 +1,119 @@
+#include "mylist/lru_cache.hpp"
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include <cstddef>
+#include <list>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+
+constexpr auto keySpace = 100'000;
+constexpr auto requestCount = 200'000;
+constexpr auto skew = 0.99;
+
+// Ключи с распределением Ципфа: ключ k выпадает с вероятностью ~ 1 / k^skew
+auto makeZipfianKeys() -> std::vector<int>
+{
+    auto cdf = std::vector<double>(keySpace);
+    auto total = 0.0;
+    for (int k = 0; k < keySpace; ++k)
+    {
+        total += 1.0 / std::pow(k + 1, skew);
+        cdf[k] = total;
+    }
+
+    auto random = std::mt19937(7);
+    auto uniform = std::uniform_real_distribution<double>(0.0, total);
+    auto keys = std::vector<int>(requestCount);
+    for (auto& key : keys)
+    {
+        key = static_cast<int>(std::ranges::lower_bound(cdf, uniform(random)) - cdf.begin());
+    }
+    return keys;
+}
+
+// Для сравнения: привычная связка std::list и unordered_map
+class StdLruCache
+{
+public:
+    explicit StdLruCache(std::size_t capacity) : mCapacity(capacity) {}
+
+    auto get(int key) -> long*
+    {
+        auto found = mIndex.find(key);
+        if (found == mIndex.end())
+        {
+            return nullptr;
+        }
+        mEntries.splice(mEntries.begin(), mEntries, found->second);
+        return &found->second->second;
+    }
+
+    void put(int key, long value)
+    {
+        if (mEntries.size() == mCapacity)
+        {
+            mIndex.erase(mEntries.back().first);
+            mEntries.pop_back();
+        }
+        mEntries.emplace_front(key, value);
+        mIndex.emplace(key, mEntries.begin());
+    }
+
+private:
+    std::list<std::pair<int, long>> mEntries;
+    std::unordered_map<int, std::list<std::pair<int, long>>::iterator> mIndex;
+    std::size_t mCapacity;
+};
+
+// Обращение к кэшу с подгрузкой значения при промахе
+template<typename Cache>
+auto replay(Cache& cache, const std::vector<int>& keys) -> std::size_t
+{
+    auto hits = std::size_t{};
+    for (auto key : keys)
+    {
+        if (cache.get(key))
+        {
+            ++hits;
+        }
+        else
+        {
+            cache.put(key, static_cast<long>(key) * 2);
+        }
+    }
+    return hits;
+}
+
+} // namespace
+
+TEST_CASE("LruCache with Zipfian keys", "[!benchmark]")
+{
+    const auto keys = makeZipfianKeys();
+
+    for (auto capacity : {1'000, 10'000})
+    {
+        auto probe = mylist::LruCache<int, long>(capacity);
+        replay(probe, keys);
+        WARN("capacity " << capacity << ": hit rate "
+                         << static_cast<double>(probe.hits()) / (probe.hits() + probe.misses()));
+
+        BENCHMARK("LruCache, capacity " + std::to_string(capacity))
+        {
+            auto cache = mylist::LruCache<int, long>(capacity);
+            return replay(cache, keys);
+        };
+
+        BENCHMARK("std::list + unordered_map, capacity " + std::to_string(capacity))
+        {
+            auto cache = StdLruCache(capacity);
+            return replay(cache, keys);
+        };
+    }
+}
@@ -0,0 +1,68 @@
+#include "mylist/list.hpp"
+#include "mylist/mapped_list.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace
+{
+
+constexpr auto elementCount = 1'000'000;
+
+} // namespace
+
+TEST_CASE("Loading a persisted list at startup", "[!benchmark]")
+{
+    auto directory = std::filesystem::temp_directory_path();
+    auto mappedPath = directory / "mylist_bench_mapped.bin";
+    auto flatPath = directory / "mylist_bench_flat.bin";
+    std::filesystem::remove(mappedPath);
+
+    // Один и тот же список: в отображаемом файле и плоским массивом значений
+    {
+        auto mapped = mylist::MappedList<std::int64_t>(mappedPath);
+        auto values = std::vector<std::int64_t>();
+        for (std::int64_t i = 0; i < elementCount; ++i)
+        {
+            mapped.pushTail(i);
+            values.push_back(i);
+        }
+        auto os = std::ofstream(flatPath, std::ios::binary);
+        os.write(reinterpret_cast<const char*>(values.data()),
+                 static_cast<std::streamsize>(values.size() * sizeof(std::int64_t)));
+    }
+
+    BENCHMARK("List, read file and rebuild")
+    {
+        auto is = std::ifstream(flatPath, std::ios::binary);
+        auto ls = mylist::List<std::int64_t>();
+        for (std::int64_t value; is.read(reinterpret_cast<char*>(&value), sizeof(value));)
+        {
+            ls.pushTail(value);
+        }
+        return ls.size();
+    };
+
+    BENCHMARK("MappedList, reopen")
+    {
+        auto mapped = mylist::MappedList<std::int64_t>(mappedPath);
+        return mapped.peekTail();
+    };
+
+    BENCHMARK("MappedList, reopen and traverse")
+    {
+        auto mapped = mylist::MappedList<std::int64_t>(mappedPath);
+        auto sum = std::int64_t{};
+        for (auto value : mapped)
+        {
+            sum += value;
+        }
+        return sum;
+    };
+
+    std::filesystem::remove(mappedPath);
+    std::filesystem::remove(flatPath);
+}
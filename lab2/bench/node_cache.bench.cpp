@@ -0,0 +1,65 @@
+#include "mylist/list.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+constexpr auto operationCount = 100'000;
+constexpr auto backlog = 64;
+
+// Каждый поток гоняет свою очередь: pushTail нового элемента, popHead старого
+template<typename MakeList>
+auto churn(int threadCount, MakeList makeList) -> long
+{
+    auto sums = std::vector<long>(threadCount);
+    auto threads = std::vector<std::thread>();
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&, t] {
+            auto ls = makeList();
+            for (int i = 0; i < backlog; ++i)
+            {
+                ls.pushTail(i);
+            }
+            for (int i = 0; i < operationCount; ++i)
+            {
+                ls.pushTail(i);
+                sums[t] += *ls.popHead();
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    auto total = 0L;
+    for (auto sum : sums)
+    {
+        total += sum;
+    }
+    return total;
+}
+
+} // namespace
+
+TEST_CASE("Multi-threaded pushTail/popHead churn", "[!benchmark]")
+{
+    for (auto threadCount : {1, 4})
+    {
+        BENCHMARK("thread-local node cache, threads " + std::to_string(threadCount))
+        {
+            return churn(threadCount, [] { return mylist::List<int>(); });
+        };
+
+        BENCHMARK("global allocator, threads " + std::to_string(threadCount))
+        {
+            return churn(threadCount, [] { return mylist::pmr::List<int>(std::pmr::new_delete_resource()); });
+        };
+    }
+}
@@ -0,0 +1,61 @@
+#include "mylist/list.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+
+constexpr auto elementCount = 100'000;
+
+} // namespace
+
+TEST_CASE("Checked vs non-throwing API", "[!benchmark]")
+{
+    auto values = std::vector<int>(elementCount);
+    std::iota(values.begin(), values.end(), 0);
+    auto ls = mylist::List<int>(values);
+
+    BENCHMARK("traversal, operator* and operator++")
+    {
+        auto sum = 0L;
+        for (auto it = ls.cbegin(), end = ls.cend(); it != end; ++it)
+        {
+            sum += *it;
+        }
+        return sum;
+    };
+
+    BENCHMARK("traversal, tryGet and tryNext")
+    {
+        auto sum = 0L;
+        auto it = ls.cbegin();
+        while (auto value = it.tryGet())
+        {
+            sum += *value;
+            it.tryNext();
+        }
+        return sum;
+    };
+
+    BENCHMARK("insertAfter the head")
+    {
+        auto target = mylist::List<int>{0};
+        for (int i = 0; i < elementCount; ++i)
+        {
+            target.insertAfter(target.cbegin(), i);
+        }
+        return target.size();
+    };
+
+    BENCHMARK("tryInsertAfter the head")
+    {
+        auto target = mylist::List<int>{0};
+        for (int i = 0; i < elementCount; ++i)
+        {
+            target.tryInsertAfter(target.cbegin(), i);
+        }
+        return target.size();
+    };
+}
@@ -0,0 +1,46 @@
+#include "mylist/list.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr auto elementCount = 1'000'000;
+
+} // namespace
+
+TEST_CASE("Parallel copy of a List<std::string>", "[!benchmark]")
+{
+    auto source = std::vector<std::string>();
+    source.reserve(elementCount);
+    for (int i = 0; i < elementCount; ++i)
+    {
+        source.push_back("entry number " + std::to_string(i));
+    }
+    const auto ls = mylist::List<std::string>(source.begin(), source.end());
+
+    BENCHMARK("copy constructor")
+    {
+        return mylist::List<std::string>(ls).size();
+    };
+
+    for (auto threads : {2u, 4u})
+    {
+        BENCHMARK("parallel copy, threads " + std::to_string(threads))
+        {
+            return mylist::List<std::string>(mylist::Parallel{threads}, ls).size();
+        };
+    }
+
+    BENCHMARK("from vector")
+    {
+        return mylist::List<std::string>(source.begin(), source.end()).size();
+    };
+
+    BENCHMARK("parallel from vector, threads 4")
+    {
+        return mylist::List<std::string>(mylist::Parallel{4}, source.begin(), source.end()).size();
+    };
+}
@@ -0,0 +1,62 @@
+#include "mylist/list.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace
+{
+
+constexpr auto elementCount = 10'000;
+
+// Один «запрос»: короткоживущий список, который собирают, читают и выбрасывают
+template<typename ListType>
+auto handleRequest(ListType& ls) -> long
+{
+    for (int i = 0; i < elementCount; ++i)
+    {
+        ls.pushTail(i);
+    }
+
+    auto sum = 0L;
+    ls.forEach([&](int value) { sum += value; });
+    return sum;
+}
+
+} // namespace
+
+TEST_CASE("Request-scoped lists with memory resources", "[!benchmark]")
+{
+    // Буфер переиспользуется между запросами, как в обработчике с ареной на поток
+    auto buffer = std::vector<std::byte>(elementCount * 128);
+
+    BENCHMARK("default allocation")
+    {
+        auto ls = mylist::List<int>();
+        return handleRequest(ls);
+    };
+
+    BENCHMARK("monotonic arena, clear()")
+    {
+        auto arena = std::pmr::monotonic_buffer_resource(buffer.data(), buffer.size());
+        auto ls = mylist::pmr::List<int>(&arena);
+        return handleRequest(ls);
+    };
+
+    BENCHMARK("monotonic arena, abandon()")
+    {
+        auto arena = std::pmr::monotonic_buffer_resource(buffer.data(), buffer.size());
+        auto ls = mylist::pmr::List<int>(&arena);
+        auto sum = handleRequest(ls);
+        ls.abandon();
+        return sum;
+    };
+
+    BENCHMARK("unsynchronized pool")
+    {
+        auto pool = std::pmr::unsynchronized_pool_resource();
+        auto ls = mylist::pmr::List<int>(&pool);
+        return handleRequest(ls);
+    };
+}
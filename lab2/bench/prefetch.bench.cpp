@@ -0,0 +1,65 @@
+#include "mylist/list.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+// Узлы (~100 байт с блоком управления) заведомо не помещаются в LLC
+constexpr auto elementCount = std::size_t{1} << 21;
+
+// Каждый элемент вставляется перед случайным уже существующим,
+// так что соседние по списку узлы разбросаны по куче
+auto makeScattered() -> mylist::List<long>
+{
+    auto ls = mylist::List<long>{0};
+    auto positions = std::vector<mylist::List<long>::const_iterator>{ls.cbegin()};
+    positions.reserve(elementCount);
+    auto random = std::mt19937(42);
+    for (std::size_t i = 1; i < elementCount; ++i)
+    {
+        auto position = positions[random() % positions.size()];
+        positions.push_back(ls.emplaceBefore(position, static_cast<long>(i)));
+    }
+    return ls;
+}
+
+} // namespace
+
+TEST_CASE("Prefetching traversal of a scattered list", "[!benchmark]")
+{
+    auto ls = makeScattered();
+
+    for (auto distance : {0, 2, 4, 8, 16})
+    {
+        ls.setPrefetchDistance(distance);
+        BENCHMARK("forEach, distance " + std::to_string(distance))
+        {
+            auto sum = 0L;
+            ls.forEach([&](long value) { sum += value; });
+            return sum;
+        };
+    }
+
+    BENCHMARK("range-for")
+    {
+        auto sum = 0L;
+        for (auto value : ls)
+        {
+            sum += value;
+        }
+        return sum;
+    };
+
+    for (auto distance : {0, 8})
+    {
+        ls.setPrefetchDistance(distance);
+        BENCHMARK("copy, distance " + std::to_string(distance))
+        {
+            return mylist::List<long>(ls).size();
+        };
+    }
+}
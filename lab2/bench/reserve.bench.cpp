@@ -0,0 +1,108 @@
+#include "mylist/list.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <memory_resource>
+
+namespace
+{
+
+constexpr auto backlog = 1'000;
+constexpr auto operationCount = 100'000;
+
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    std::size_t allocations{};
+
+private:
+    auto do_allocate(std::size_t size, std::size_t alignment) -> void* override
+    {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(size, alignment);
+    }
+
+    void do_deallocate(void* pointer, std::size_t size, std::size_t alignment) override
+    {
+        std::pmr::new_delete_resource()->deallocate(pointer, size, alignment);
+    }
+
+    auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override
+    {
+        return this == &other;
+    }
+};
+
+// Очередь из backlog элементов: pushTail нового, popHead старого, а раз в
+// тысячу операций — полный слив и наполнение заново
+template<typename ListType>
+auto churn(ListType& ls) -> long
+{
+    auto sum = 0L;
+    for (int i = 0; i < backlog; ++i)
+    {
+        ls.pushTail(i);
+    }
+    for (int i = 0; i < operationCount; ++i)
+    {
+        ls.pushTail(i);
+        sum += *ls.popHead();
+        if (i % 1'000 == 0)
+        {
+            while (!ls.empty())
+            {
+                sum += *ls.popTail();
+            }
+            for (int j = 0; j < backlog; ++j)
+            {
+                ls.pushHead(j);
+            }
+        }
+    }
+    ls.clear();
+    return sum;
+}
+
+} // namespace
+
+TEST_CASE("pushTail/popHead churn with a node reserve", "[!benchmark]")
+{
+    {
+        auto plain = CountingResource();
+        auto reserved = CountingResource();
+        auto ls = mylist::pmr::List<int>(&plain);
+        churn(ls);
+        auto warm = mylist::pmr::List<int>(&reserved);
+        warm.reserve(backlog + 1);
+        auto upfront = reserved.allocations;
+        churn(warm);
+        WARN("allocations per churn: no reserve " << plain.allocations << ", reserve " << upfront << " up front + "
+                                                  << reserved.allocations - upfront << " during the churn");
+    }
+
+    BENCHMARK("global allocator, no reserve")
+    {
+        auto ls = mylist::pmr::List<int>(std::pmr::new_delete_resource());
+        return churn(ls);
+    };
+
+    auto reserved = mylist::pmr::List<int>(std::pmr::new_delete_resource());
+    reserved.reserve(backlog + 1);
+    BENCHMARK("global allocator, reserve")
+    {
+        return churn(reserved);
+    };
+
+    BENCHMARK("thread-local node cache, no reserve")
+    {
+        auto ls = mylist::List<int>();
+        return churn(ls);
+    };
+
+    auto cached = mylist::List<int>();
+    cached.reserve(backlog + 1);
+    BENCHMARK("thread-local node cache, reserve")
+    {
+        return churn(cached);
+    };
+}
@@ -0,0 +1,54 @@
+#include "mylist/list.hpp"
+#include "mylist/ring_list.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory_resource>
+
+namespace
+{
+
+constexpr auto window = 1'024;
+constexpr auto eventCount = 200'000;
+
+} // namespace
+
+TEST_CASE("Keeping the last N events", "[!benchmark]")
+{
+    BENCHMARK("List pushTail + popHead, thread-local node cache")
+    {
+        auto ls = mylist::List<long>();
+        for (long i = 0; i < eventCount; ++i)
+        {
+            ls.pushTail(i);
+            if (ls.size() > window)
+            {
+                ls.popHead();
+            }
+        }
+        return ls.peekHead();
+    };
+
+    BENCHMARK("List pushTail + popHead, global allocator")
+    {
+        auto ls = mylist::pmr::List<long>(std::pmr::new_delete_resource());
+        for (long i = 0; i < eventCount; ++i)
+        {
+            ls.pushTail(i);
+            if (ls.size() > window)
+            {
+                ls.popHead();
+            }
+        }
+        return ls.peekHead();
+    };
+
+    BENCHMARK("RingList overwriteOldest")
+    {
+        auto ring = mylist::RingList<long>(window);
+        for (long i = 0; i < eventCount; ++i)
+        {
+            ring.pushTail(i);
+        }
+        return ring.peekHead();
+    };
+}
@@ -0,0 +1,67 @@
+#include "mylist/list.hpp"
+#include "mylist/sharded_list.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+constexpr auto elementCount = 400'000;
+
+template<typename Push>
+void ingest(int threadCount, Push push)
+{
+    auto threads = std::vector<std::thread>();
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&, t] {
+            for (int i = t; i < elementCount; i += threadCount)
+            {
+                push(i);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+} // namespace
+
+TEST_CASE("Multi-threaded ingest into one sequence", "[!benchmark]")
+{
+    for (auto threadCount : {1, 4})
+    {
+        auto suffix = ", threads " + std::to_string(threadCount);
+
+        BENCHMARK("List + mutex" + suffix)
+        {
+            auto ls = mylist::List<int>();
+            auto mutex = std::mutex();
+            ingest(threadCount, [&](int value) {
+                auto lock = std::lock_guard(mutex);
+                ls.pushTail(value);
+            });
+            return ls.size();
+        };
+
+        BENCHMARK("ShardedList, collect()" + suffix)
+        {
+            auto ls = mylist::ShardedList<int>();
+            ingest(threadCount, [&](int value) { ls.pushTail(value); });
+            return ls.collect().size();
+        };
+
+        BENCHMARK("ShardedList, collect(key)" + suffix)
+        {
+            auto ls = mylist::ShardedList<int>();
+            ingest(threadCount, [&](int value) { ls.pushTail(value); });
+            return ls.collect([](int value) { return value; }).size();
+        };
+    }
+}
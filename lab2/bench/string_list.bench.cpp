@@ -0,0 +1,141 @@
+#include "mylist/list.hpp"
+#include "mylist/string_list.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr auto elementCount = 200'000;
+constexpr auto distinctCount = 5'000;
+
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    std::size_t bytes{};
+
+private:
+    auto do_allocate(std::size_t size, std::size_t alignment) -> void* override
+    {
+        bytes += size;
+        return std::pmr::new_delete_resource()->allocate(size, alignment);
+    }
+
+    void do_deallocate(void* pointer, std::size_t size, std::size_t alignment) override
+    {
+        bytes -= size;
+        std::pmr::new_delete_resource()->deallocate(pointer, size, alignment);
+    }
+
+    auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override
+    {
+        return this == &other;
+    }
+};
+
+// Строки длиной 4-40 символов из ограниченного словаря, как имена и метки
+auto makeInput() -> std::vector<std::string>
+{
+    auto random = std::mt19937(3);
+    auto length = std::uniform_int_distribution<std::size_t>(4, 40);
+    auto letter = std::uniform_int_distribution<int>('a', 'z');
+    auto words = std::vector<std::string>(distinctCount);
+    for (auto& word : words)
+    {
+        word.resize(length(random));
+        for (auto& ch : word)
+        {
+            ch = static_cast<char>(letter(random));
+        }
+    }
+
+    auto pick = std::uniform_int_distribution<std::size_t>(0, distinctCount - 1);
+    auto input = std::vector<std::string>(elementCount);
+    for (auto& str : input)
+    {
+        str = words[pick(random)];
+    }
+    return input;
+}
+
+} // namespace
+
+TEST_CASE("Lists of strings", "[!benchmark]")
+{
+    const auto input = makeInput();
+
+    {
+        // Узлы считаются ресурсом, буферы строк — по их ёмкости вне SSO
+        auto counting = CountingResource();
+        auto ls = mylist::pmr::List<std::string>(&counting);
+        auto buffers = std::size_t{};
+        for (const auto& str : input)
+        {
+            ls.pushTail(str);
+        }
+        ls.forEach([&](const std::string& str) {
+            buffers += str.capacity() > std::string().capacity() ? str.capacity() + 1 : 0;
+        });
+        auto plain = mylist::StringList(input.begin(), input.end());
+        auto interned = mylist::StringList(std::make_shared<mylist::StringArena>(true));
+        interned.append(input.begin(), input.end());
+        WARN("bytes per element: List<std::string> " << static_cast<double>(counting.bytes + buffers) / elementCount
+                                                     << ", StringList "
+                                                     << static_cast<double>(plain.storageBytes()) / elementCount
+                                                     << ", interned StringList "
+                                                     << static_cast<double>(interned.storageBytes()) / elementCount);
+    }
+
+    BENCHMARK("List<std::string>, build")
+    {
+        return mylist::List<std::string>(input.begin(), input.end()).size();
+    };
+
+    BENCHMARK("StringList, build")
+    {
+        return mylist::StringList(input.begin(), input.end()).size();
+    };
+
+    BENCHMARK("StringList interned, build")
+    {
+        auto ls = mylist::StringList(std::make_shared<mylist::StringArena>(true));
+        ls.append(input.begin(), input.end());
+        return ls.size();
+    };
+
+    auto ls = mylist::List<std::string>(input.begin(), input.end());
+    auto strings = mylist::StringList(input.begin(), input.end());
+
+    BENCHMARK("List<std::string>, iterate")
+    {
+        auto total = std::size_t{};
+        ls.forEach([&](const std::string& str) { total += str.size() + static_cast<unsigned char>(str.back()); });
+        return total;
+    };
+
+    BENCHMARK("StringList, iterate")
+    {
+        auto total = std::size_t{};
+        for (auto str : strings)
+        {
+            total += str.size() + static_cast<unsigned char>(str.back());
+        }
+        return total;
+    };
+
+    BENCHMARK("List<std::string>, copy")
+    {
+        return mylist::List<std::string>(ls).size();
+    };
+
+    BENCHMARK("StringList, copy")
+    {
+        return mylist::StringList(strings).size();
+    };
+}
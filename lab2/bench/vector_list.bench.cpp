@@ -0,0 +1,78 @@
+#include "mylist/list.hpp"
+#include "mylist/vector_list.hpp"
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <numeric>
+
+namespace
+{
+
+constexpr auto elementCount = std::size_t{1} << 18;
+
+// Вставки в середину перемешивают порядок узлов относительно обхода
+template<typename Ls>
+auto makeShuffled() -> Ls
+{
+    auto ls = Ls{0};
+    auto middle = ls.end();
+    for (std::size_t i = 1; i < elementCount; ++i)
+    {
+        ls.insertBefore(middle, static_cast<int>(i));
+        if (i % 2 == 0)
+        {
+            middle = std::prev(middle);
+        }
+    }
+    return ls;
+}
+
+} // namespace
+
+TEST_CASE("Traversal of List and VectorList", "[!benchmark]")
+{
+    auto list = makeShuffled<mylist::List<int>>();
+    auto vectorList = makeShuffled<mylist::VectorList<int>>();
+
+    BENCHMARK("List")
+    {
+        return std::accumulate(list.begin(), list.end(), 0LL);
+    };
+
+    BENCHMARK("VectorList")
+    {
+        return std::accumulate(vectorList.begin(), vectorList.end(), 0LL);
+    };
+
+    BENCHMARK("VectorList after shrink_to_fit")
+    {
+        vectorList.shrink_to_fit();
+        return std::accumulate(vectorList.begin(), vectorList.end(), 0LL);
+    };
+}
+
+TEST_CASE("Push/pop churn of List and VectorList", "[!benchmark]")
+{
+    auto list = mylist::List<int>(1024, 0);
+    auto vectorList = mylist::VectorList<int>(1024, 0);
+
+    BENCHMARK("List")
+    {
+        for (int i = 0; i < 4096; ++i)
+        {
+            list.pushTail(i);
+            list.popHead();
+        }
+        return list.size();
+    };
+
+    BENCHMARK("VectorList")
+    {
+        for (int i = 0; i < 4096; ++i)
+        {
+            vectorList.pushTail(i);
+            vectorList.popHead();
+        }
+        return vectorList.size();
+    };
+}
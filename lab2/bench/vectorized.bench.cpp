@@ -0,0 +1,113 @@
+#include "mylist/vector_list.hpp"
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr auto elementCount = std::size_t{1} << 20;
+
+template<typename T>
+constexpr auto typeName = "";
+
+template<>
+constexpr auto typeName<std::int32_t> = "int32";
+
+template<>
+constexpr auto typeName<float> = "float";
+
+template<>
+constexpr auto typeName<double> = "double";
+
+} // namespace
+
+// Обобщённые варианты идут через итераторы по связям, как для любого T
+TEMPLATE_TEST_CASE("Trivially copyable fast paths of VectorList", "[!benchmark]", std::int32_t, float, double)
+{
+    auto source = std::vector<TestType>(elementCount);
+    for (std::size_t i = 0; i < elementCount; ++i)
+    {
+        source[i] = static_cast<TestType>(i % 1000);
+    }
+    const auto ls = mylist::VectorList<TestType>(source);
+    const auto absent = static_cast<TestType>(-1);
+    auto name = [](const char* what) { return std::string(what) + ", " + typeName<TestType>; };
+
+    BENCHMARK(name("build by pushTail"))
+    {
+        auto built = mylist::VectorList<TestType>();
+        built.reserve(elementCount);
+        for (auto value : source)
+        {
+            built.pushTail(value);
+        }
+        return built.size();
+    };
+
+    BENCHMARK(name("build by memcpy"))
+    {
+        auto built = mylist::VectorList<TestType>();
+        built.append(source.begin(), source.end());
+        return built.size();
+    };
+
+    auto out = std::vector<TestType>(elementCount);
+
+    BENCHMARK(name("copy out by iterators"))
+    {
+        return std::ranges::copy(ls, out.begin()).out - out.begin();
+    };
+
+    BENCHMARK(name("copy out by memcpy"))
+    {
+        return ls.copyTo(out.begin()) - out.begin();
+    };
+
+    BENCHMARK(name("find by iterators"))
+    {
+        return std::ranges::find(ls, absent) == ls.end();
+    };
+
+    BENCHMARK(name("find vectorized"))
+    {
+        return ls.find(absent) == ls.end();
+    };
+
+    BENCHMARK(name("count by iterators"))
+    {
+        return std::ranges::count(ls, static_cast<TestType>(7));
+    };
+
+    BENCHMARK(name("count vectorized"))
+    {
+        return ls.count(static_cast<TestType>(7));
+    };
+
+    BENCHMARK(name("min by iterators"))
+    {
+        return std::ranges::min(ls);
+    };
+
+    BENCHMARK(name("min vectorized"))
+    {
+        return *ls.min();
+    };
+
+    const auto other = ls;
+
+    BENCHMARK(name("equal by iterators"))
+    {
+        return std::ranges::equal(ls, other);
+    };
+
+    BENCHMARK(name("equal vectorized"))
+    {
+        return ls == other;
+    };
+}
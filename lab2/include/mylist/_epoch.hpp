@@ -0,0 +1,159 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace mylist
+{
+
+// Эпохальное освобождение памяти для одного писателя и многих читателей.
+// Читатель на время обхода занимает слот с текущей эпохой, писатель
+// откладывает удаление отцепленных узлов, пока их могут видеть читатели.
+class EpochDomain
+{
+public:
+    using size_type = std::size_t;
+
+    static constexpr size_type maxReaders = 64;
+    static constexpr size_type collectThreshold = 64;
+
+    class Guard
+    {
+        friend class EpochDomain;
+    public:
+        Guard(const Guard&) = delete;
+        auto operator=(const Guard&) -> Guard& = delete;
+
+        Guard(Guard&& that) noexcept : mSlot(std::exchange(that.mSlot, nullptr)) {}
+
+        auto operator=(Guard&& that) noexcept -> Guard&
+        {
+            if (this != &that)
+            {
+                release();
+                mSlot = std::exchange(that.mSlot, nullptr);
+            }
+            return *this;
+        }
+
+        ~Guard()
+        {
+            release();
+        }
+
+    private:
+        std::atomic<std::uint64_t>* mSlot{};
+
+        explicit Guard(std::atomic<std::uint64_t>* slot) noexcept : mSlot(slot) {}
+
+        void release() noexcept
+        {
+            if (mSlot)
+            {
+                mSlot->store(0);
+            }
+        }
+    };
+
+    EpochDomain() = default;
+    EpochDomain(const EpochDomain&) = delete;
+    auto operator=(const EpochDomain&) -> EpochDomain& = delete;
+
+    // Вызывается, когда читателей уже нет
+    ~EpochDomain()
+    {
+        for (auto& retired : mRetired)
+        {
+            retired.deleter(retired.pointer);
+        }
+    }
+
+    // Входит в критическую секцию читателя; ждёт, если заняты все слоты
+    auto pin() -> Guard
+    {
+        while (true)
+        {
+            for (auto& slot : mSlots)
+            {
+                auto expected = std::uint64_t{0};
+                if (slot.value.compare_exchange_strong(expected, mEpoch.load()))
+                {
+                    // Парный барьер в collect(): либо писатель увидит слот,
+                    // либо читатель увидит уже отцеплённые узлы
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    return Guard(&slot.value);
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    // Только для писателя: узел уже недостижим из структуры
+    void retire(void* pointer, void (*deleter)(void*))
+    {
+        mRetired.push_back({pointer, deleter, mEpoch.fetch_add(1)});
+        if (mRetired.size() >= collectThreshold)
+        {
+            collect();
+        }
+    }
+
+    // Только для писателя: освобождает узлы, которые не видит ни один читатель
+    void collect()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto minActive = std::numeric_limits<std::uint64_t>::max();
+        for (const auto& slot : mSlots)
+        {
+            auto epoch = slot.value.load();
+            if (epoch != 0 && epoch < minActive)
+            {
+                minActive = epoch;
+            }
+        }
+
+        auto kept = mRetired.begin();
+        for (auto& retired : mRetired)
+        {
+            if (retired.epoch < minActive)
+            {
+                retired.deleter(retired.pointer);
+            }
+            else
+            {
+                *kept++ = retired;
+            }
+        }
+        mRetired.erase(kept, mRetired.end());
+    }
+
+    auto pending() const noexcept -> size_type
+    {
+        return mRetired.size();
+    }
+
+private:
+    struct Retired
+    {
+        void* pointer;
+        void (*deleter)(void*);
+        std::uint64_t epoch;
+    };
+
+    struct alignas(64) Slot
+    {
+        std::atomic<std::uint64_t> value{};
+    };
+
+    std::atomic<std::uint64_t> mEpoch{1};
+    std::array<Slot, maxReaders> mSlots{};
+    std::vector<Retired> mRetired;
+};
+
+} // namespace mylist
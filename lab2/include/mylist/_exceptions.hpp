@@ -38,4 +38,15 @@ public:
     }
 };
 
+class MappedListFormatException : public std::runtime_error
+{
+public:
+    MappedListFormatException(const char* msg) noexcept : std::runtime_error(msg) {}
+
+    auto what() const noexcept -> const char* override
+    {
+        return std::runtime_error::what();
+    }
+};
+
 } // namespace mylist
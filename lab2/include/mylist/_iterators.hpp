@@ -2,6 +2,7 @@
 
 #include "_node.hpp"
 #include "_exceptions.hpp"
+#include <cstddef>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -10,7 +11,7 @@
 namespace mylist
 {
 
-template<typename T>
+template<typename T, typename Allocator>
 class List;
 
 template<typename T>
@@ -19,7 +20,8 @@ class ConstIterator;
 template<typename T>
 class Iterator
 {
-    friend class List<T>;
+    template<typename, typename>
+    friend class List;
     friend class ConstIterator<T>;
 public:
     using iterator_category = std::bidirectional_iterator_tag;
@@ -31,11 +33,14 @@ public:
 
     Iterator() = default;
 
-    Iterator(std::weak_ptr<Node<value_type>> node) : currentNode(node) {}
+    Iterator(std::weak_ptr<Node<value_type>> node) : Iterator(node.lock()) {}
 
-    Iterator(std::shared_ptr<Node<value_type>> node) : currentNode(node) {}
+    Iterator(std::shared_ptr<Node<value_type>> node)
+        : currentNode(node), currentGeneration(node ? node->generation : 0)
+    {
+    }
 
-    Iterator(const Iterator& that) : currentNode(that.currentNode) {}
+    Iterator(const Iterator& that) : currentNode(that.currentNode), currentGeneration(that.currentGeneration) {}
 
     auto operator=(const Iterator& that) -> Iterator&
     {
@@ -49,12 +54,12 @@ public:
     void swap(Iterator& that) noexcept
     {
         std::swap(currentNode, that.currentNode);
+        std::swap(currentGeneration, that.currentGeneration);
     }
 
     auto operator++() -> Iterator&
     {
-        validateIterator();
-        currentNode = currentNode.lock()->next;
+        moveTo(validateIterator()->next);
         return *this;
     }
 
@@ -67,8 +72,7 @@ public:
 
     auto operator--() -> Iterator&
     {
-        validateIterator();
-        currentNode = currentNode.lock()->prev;
+        moveTo(validateIterator()->prev.lock());
         return *this;
     }
 
@@ -81,19 +85,17 @@ public:
 
     auto operator*() const -> reference
     {
-        validateIterator();
-        return currentNode.lock()->value;
+        return validateIterator()->value;
     }
 
     auto operator->() const -> pointer
     {
-        validateIterator();
-        return &currentNode.lock()->value;
+        return &validateIterator()->value;
     }
 
     friend auto operator==(const Iterator& lhs, const Iterator& rhs) -> bool
     {
-        return lhs.currentNode.lock() == rhs.currentNode.lock();
+        return lhs.lockNode() == rhs.lockNode();
     }
 
     friend auto operator!=(const Iterator& lhs, const Iterator& rhs) -> bool
@@ -103,25 +105,76 @@ public:
 
     auto dangling() const noexcept -> bool
     {
-        return currentNode.expired();
+        return !lockNode();
+    }
+
+    // Варианты без исключений: висячий итератор даёт nullptr или false
+    // и не сдвигается. Узел блокируется один раз, без отдельной проверки
+    auto tryGet() const noexcept -> pointer
+    {
+        auto node = lockNode();
+        return node ? &node->value : nullptr;
+    }
+
+    auto tryNext() noexcept -> bool
+    {
+        auto node = lockNode();
+        if (!node)
+        {
+            return false;
+        }
+        moveTo(node->next);
+        return true;
+    }
+
+    auto tryPrev() noexcept -> bool
+    {
+        auto node = lockNode();
+        if (!node)
+        {
+            return false;
+        }
+        moveTo(node->prev.lock());
+        return true;
     }
 
 private:
     std::weak_ptr<Node<value_type>> currentNode{};
+    std::size_t currentGeneration{};
 
-    auto validateIterator() const -> void
+    // Узел итератора или nullptr, если узел освобождён или переиспользован
+    auto lockNode() const noexcept -> std::shared_ptr<Node<value_type>>
     {
-        if (currentNode.expired())
+        auto node = currentNode.lock();
+        if (node && node->generation != currentGeneration)
+        {
+            node.reset();
+        }
+        return node;
+    }
+
+    auto validateIterator() const -> std::shared_ptr<Node<value_type>>
+    {
+        auto node = lockNode();
+        if (!node)
         {
             throw DanglingIteratorException("Trying to dereference dangling iterator");
         }
+        return node;
+    }
+
+    void moveTo(const std::shared_ptr<Node<value_type>>& node) noexcept
+    {
+        currentNode = node;
+        currentGeneration = node ? node->generation : 0;
     }
 };
 
 template<typename T>
 class ConstIterator
 {
-    friend class List<T>;
+    template<typename, typename>
+    friend class List;
 public:
     using iterator_category = std::bidirectional_iterator_tag;
     using iterator_concept = std::bidirectional_iterator_tag;
@@ -132,13 +185,21 @@ public:
 
     ConstIterator() = default;
 
-    ConstIterator(std::weak_ptr<Node<value_type>> node) : currentNode(node) {}
+    ConstIterator(std::weak_ptr<Node<value_type>> node) : ConstIterator(node.lock()) {}
 
-    ConstIterator(std::shared_ptr<Node<value_type>> node) : currentNode(node) {}
+    ConstIterator(std::shared_ptr<Node<value_type>> node)
+        : currentNode(node), currentGeneration(node ? node->generation : 0)
+    {
+    }
 
-    ConstIterator(const ConstIterator& that) : currentNode(that.currentNode) {}
+    ConstIterator(const ConstIterator& that)
+        : currentNode(that.currentNode), currentGeneration(that.currentGeneration)
+    {
+    }
 
-    ConstIterator(const Iterator<T>& that) : currentNode(that.currentNode) {}
+    ConstIterator(const Iterator<T>& that) : currentNode(that.currentNode), currentGeneration(that.currentGeneration)
+    {
+    }
 
     auto operator=(const ConstIterator& that) -> ConstIterator&
     {
@@ -161,12 +222,12 @@ public:
     void swap(ConstIterator& that) noexcept
     {
         std::swap(currentNode, that.currentNode);
+        std::swap(currentGeneration, that.currentGeneration);
     }
 
     auto operator++() -> ConstIterator&
     {
-        validateIterator();
-        currentNode = currentNode.lock()->next;
+        moveTo(validateIterator()->next);
         return *this;
     }
 
@@ -179,8 +240,7 @@ public:
 
     auto operator--() -> ConstIterator&
     {
-        validateIterator();
-        currentNode = currentNode.lock()->prev;
+        moveTo(validateIterator()->prev.lock());
         return *this;
     }
 
@@ -193,19 +253,17 @@ public:
 
     auto operator*() const -> reference
     {
-        validateIterator();
-        return currentNode.lock()->value;
+        return validateIterator()->value;
     }
 
     auto operator->() const -> pointer
     {
-        validateIterator();
-        return &currentNode.lock()->value;
+        return &validateIterator()->value;
     }
 
     friend auto operator==(const ConstIterator& lhs, const ConstIterator& rhs) -> bool
     {
-        return lhs.currentNode.lock() == rhs.currentNode.lock();
+        return lhs.lockNode() == rhs.lockNode();
     }
 
     friend auto operator!=(const ConstIterator& lhs, const ConstIterator& rhs) -> bool
@@ -215,18 +273,66 @@ public:
 
     auto dangling() const noexcept -> bool
     {
-        return currentNode.expired();
+        return !lockNode();
+    }
+
+    auto tryGet() const noexcept -> pointer
+    {
+        auto node = lockNode();
+        return node ? &node->value : nullptr;
+    }
+
+    auto tryNext() noexcept -> bool
+    {
+        auto node = lockNode();
+        if (!node)
+        {
+            return false;
+        }
+        moveTo(node->next);
+        return true;
+    }
+
+    auto tryPrev() noexcept -> bool
+    {
+        auto node = lockNode();
+        if (!node)
+        {
+            return false;
+        }
+        moveTo(node->prev.lock());
+        return true;
     }
 
 private:
     std::weak_ptr<Node<value_type>> currentNode{};
+    std::size_t currentGeneration{};
+
+    // Узел итератора или nullptr, если узел освобождён или переиспользован
+    auto lockNode() const noexcept -> std::shared_ptr<Node<value_type>>
+    {
+        auto node = currentNode.lock();
+        if (node && node->generation != currentGeneration)
+        {
+            node.reset();
+        }
+        return node;
+    }
 
-    auto validateIterator() const -> void
+    auto validateIterator() const -> std::shared_ptr<Node<value_type>>
     {
-        if (currentNode.expired())
+        auto node = lockNode();
+        if (!node)
         {
             throw DanglingIteratorException("Trying to dereference dangling iterator");
         }
+        return node;
+    }
+
+    void moveTo(const std::shared_ptr<Node<value_type>>& node) noexcept
+    {
+        currentNode = node;
+        currentGeneration = node ? node->generation : 0;
     }
 };
 
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+namespace mylist
+{
+
+// Типы, для которых поиск и сравнение по непрерывному массиву сводятся
+// к простым циклам, которые компилятор векторизует. Равенство везде через
+// std::equal_to: это то же ==, но без -Wfloat-equal на каждом вызове
+template<typename T>
+concept Vectorizable = std::is_arithmetic_v<T>;
+
+// Циклы ниже идут блоками по 64 байта с независимыми полосами: без
+// зависимости между итерациями внутреннего цикла компилятор раскладывает
+// его по SIMD-регистрам даже без -ffast-math
+template<Vectorizable T>
+inline constexpr std::size_t laneCount = std::max<std::size_t>(64 / sizeof(T), 1);
+
+// Результат сравнения полосы как маска ширины T: так компилятор держит
+// сравнения и их свёртку в одних векторных регистрах, а bool мешает этому
+template<Vectorizable T>
+using LaneMask = std::conditional_t<sizeof(T) <= sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+
+// Индекс первого элемента, равного value, или count
+template<Vectorizable T>
+auto findValue(const T* data, std::size_t count, T value) noexcept -> std::size_t
+{
+    constexpr auto lanes = laneCount<T>;
+    auto i = std::size_t{};
+    for (; i + lanes <= count; i += lanes)
+    {
+        auto hit = LaneMask<T>{};
+        for (std::size_t lane = 0; lane < lanes; ++lane)
+        {
+            hit |= LaneMask<T>{} - std::equal_to<T>()(data[i + lane], value);
+        }
+        if (hit != 0)
+        {
+            break;
+        }
+    }
+    for (; i < count; ++i)
+    {
+        if (std::equal_to<T>()(data[i], value))
+        {
+            return i;
+        }
+    }
+    return count;
+}
+
+template<Vectorizable T>
+auto countValue(const T* data, std::size_t count, T value) noexcept -> std::size_t
+{
+    // Счётчик полосы растёт не больше чем на 1 за блок и не переполняется
+    constexpr auto lanes = laneCount<T>;
+    LaneMask<T> counters[lanes] = {};
+    auto i = std::size_t{};
+    for (; i + lanes <= count; i += lanes)
+    {
+        for (std::size_t lane = 0; lane < lanes; ++lane)
+        {
+            counters[lane] += std::equal_to<T>()(data[i + lane], value);
+        }
+    }
+
+    auto total = std::size_t{};
+    for (auto counter : counters)
+    {
+        total += counter;
+    }
+    for (; i < count; ++i)
+    {
+        total += std::equal_to<T>()(data[i], value);
+    }
+    return total;
+}
+
+// Наименьшее (Less = std::less) или наибольшее значение непустого массива.
+// Из равных значений с разным представлением (0.0 и -0.0) может вернуться
+// любое; с NaN результат не определён
+template<Vectorizable T, typename Less>
+auto extremeValue(const T* data, std::size_t count, Less less) noexcept -> T
+{
+    constexpr auto lanes = laneCount<T>;
+    auto i = std::size_t{};
+    auto best = data[0];
+    if (count >= lanes)
+    {
+        T partial[lanes];
+        std::copy(data, data + lanes, partial);
+        for (i = lanes; i + lanes <= count; i += lanes)
+        {
+            for (std::size_t lane = 0; lane < lanes; ++lane)
+            {
+                partial[lane] = less(data[i + lane], partial[lane]) ? data[i + lane] : partial[lane];
+            }
+        }
+        best = partial[0];
+        for (auto value : partial)
+        {
+            best = less(value, best) ? value : best;
+        }
+    }
+    for (; i < count; ++i)
+    {
+        best = less(data[i], best) ? data[i] : best;
+    }
+    return best;
+}
+
+// Поэлементное ==, поэтому 0.0 равен -0.0, а NaN не равен ничему
+template<Vectorizable T>
+auto equalValues(const T* lhs, const T* rhs, std::size_t count) noexcept -> bool
+{
+    constexpr auto lanes = laneCount<T>;
+    auto i = std::size_t{};
+    for (; i + lanes <= count; i += lanes)
+    {
+        auto differ = LaneMask<T>{};
+        for (std::size_t lane = 0; lane < lanes; ++lane)
+        {
+            differ |= LaneMask<T>{} - !std::equal_to<T>()(lhs[i + lane], rhs[i + lane]);
+        }
+        if (differ != 0)
+        {
+            return false;
+        }
+    }
+    for (; i < count; ++i)
+    {
+        if (!std::equal_to<T>()(lhs[i], rhs[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace mylist
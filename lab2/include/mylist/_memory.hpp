@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace mylist
+{
+
+// Память структуры по видам, в байтах, запрошенных у распределителей.
+// Заголовки самого malloc и собственная куча элементов (буфер std::string
+// и т. п.) сюда не входят: их распределитель списка не видит
+struct MemoryUsage
+{
+    std::size_t nodes{};   // узлы без значений элементов: связи, пустые значения терминатора и запаса
+    std::size_t control{}; // блоки управления shared_ptr, выравнивание блоков, служебные поля и пулы
+    std::size_t payload{}; // значения элементов, sizeof(T) на элемент
+
+    auto total() const noexcept -> std::size_t
+    {
+        return nodes + control + payload;
+    }
+
+    auto operator+=(const MemoryUsage& that) noexcept -> MemoryUsage&
+    {
+        nodes += that.nodes;
+        control += that.control;
+        payload += that.payload;
+        return *this;
+    }
+
+    friend auto operator+(MemoryUsage lhs, const MemoryUsage& rhs) noexcept -> MemoryUsage
+    {
+        return lhs += rhs;
+    }
+
+    friend auto operator==(const MemoryUsage&, const MemoryUsage&) noexcept -> bool = default;
+};
+
+// Исключение, которым BlockProbe прерывает выделение
+struct ProbedSize
+{
+    std::size_t bytes;
+};
+
+// Распределитель того же размера, что и Alloc: блок управления с ним
+// устроен так же, но allocate только сообщает размер запроса и прерывает
+// выделение
+template<typename Alloc>
+struct BlockProbe : Alloc
+{
+    using value_type = typename std::allocator_traits<Alloc>::value_type;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = BlockProbe<typename std::allocator_traits<Alloc>::template rebind_alloc<U>>;
+    };
+
+    explicit BlockProbe(const Alloc& allocator) : Alloc(allocator) {}
+
+    template<typename Other>
+    BlockProbe(const BlockProbe<Other>& that) : Alloc(static_cast<const Other&>(that))
+    {
+    }
+
+    [[noreturn]] auto allocate(std::size_t count) -> value_type*
+    {
+        throw ProbedSize{count * sizeof(value_type)};
+    }
+
+    void deallocate(value_type*, std::size_t) noexcept {}
+};
+
+// Сколько байт просит у распределителя make(allocator) — вызов
+// allocate_shared, где объект лежит в одном блоке с блоком управления.
+// Тип блока зависит от стандартной библиотеки, поэтому размер узнаётся
+// пробным вызовом; результат стоит запомнить для пары типов
+template<typename Alloc, typename Make>
+    requires(!std::is_final_v<Alloc>)
+auto sharedBlockSize(const Alloc& allocator, Make make) -> std::size_t
+{
+    try
+    {
+        make(BlockProbe<Alloc>(allocator));
+    }
+    catch (const ProbedSize& probed)
+    {
+        return probed.bytes;
+    }
+    return 0;
+}
+
+} // namespace mylist
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <utility>
 
@@ -7,12 +8,20 @@ namespace mylist
 {
 
 template<typename T>
-class Node : std::enable_shared_from_this<Node<T>>
+class Node
 {
+    struct Key
+    {
+        explicit Key() = default;
+    };
+
 public:
     T value{};
     std::shared_ptr<Node> next;
     std::weak_ptr<Node> prev;
+    // Растёт, когда List убирает узел в запас: итераторы, запомнившие
+    // прежнее поколение, становятся висячими, хотя узел жив
+    std::size_t generation{};
 
     static auto create(std::convertible_to<T> auto&& value) -> std::shared_ptr<Node>
     {
@@ -24,6 +33,23 @@ public:
         return std::shared_ptr<Node>(new Node());
     }
 
+    // Узел и блок управления размещаются одним выделением из allocator
+    template<typename Alloc>
+    static auto allocate(const Alloc& allocator, std::convertible_to<T> auto&& value) -> std::shared_ptr<Node>
+    {
+        return std::allocate_shared<Node>(allocator, Key(), std::forward<decltype(value)>(value));
+    }
+
+    template<typename Alloc>
+    static auto allocate(const Alloc& allocator) -> std::shared_ptr<Node>
+    {
+        return std::allocate_shared<Node>(allocator, Key());
+    }
+
+    explicit Node(Key) {}
+    Node(Key, const T& value) : value(value) {}
+    Node(Key, T&& value) : value(std::move(value)) {}
+
 private:
     Node() = default;
     Node(const T& value) : value(value) {}
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace mylist
+{
+
+// Кэш блоков одного размера: у каждого потока свой ограниченный список
+// свободных блоков, излишки пачками уходят на общий склад, откуда их
+// забирают другие потоки. До malloc доходят только промахи по обоим уровням.
+template<std::size_t Size, std::size_t Align>
+class BlockCache
+{
+public:
+    using size_type = std::size_t;
+
+    // Сколько блоков поток держит у себя и сколько отдаёт на склад за раз
+    static constexpr size_type localLimit = 256;
+    static constexpr size_type batchSize = 128;
+
+    // Пачки сверх этого числа возвращаются системе
+    static constexpr size_type depotLimit = 64;
+
+    static auto allocate() -> void*
+    {
+        if (localDestroyed)
+        {
+            return ::operator new(blockSize, std::align_val_t(blockAlign));
+        }
+
+        auto& local = localCache();
+        if (!local.head)
+        {
+            depot().take(local);
+        }
+        if (!local.head)
+        {
+            return ::operator new(blockSize, std::align_val_t(blockAlign));
+        }
+
+        auto block = local.head;
+        local.head = block->next;
+        --local.count;
+        return block;
+    }
+
+    static void deallocate(void* pointer) noexcept
+    {
+        if (localDestroyed)
+        {
+            ::operator delete(pointer, std::align_val_t(blockAlign));
+            return;
+        }
+
+        auto& local = localCache();
+        local.head = ::new (pointer) FreeBlock{local.head};
+        if (++local.count > localLimit)
+        {
+            depot().give(local, batchSize);
+        }
+    }
+
+    // Свободные блоки в кэше текущего потока
+    static auto localBlocks() noexcept -> size_type
+    {
+        return localDestroyed ? 0 : localCache().count;
+    }
+
+    // Пачки на общем складе
+    static auto depotBatches() -> size_type
+    {
+        auto& shared = depot();
+        auto lock = std::lock_guard(shared.mutex);
+        return shared.batches.size();
+    }
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    static constexpr size_type blockAlign = Align < alignof(FreeBlock) ? alignof(FreeBlock) : Align;
+    static constexpr size_type blockSize = Size < sizeof(FreeBlock) ? sizeof(FreeBlock) : Size;
+
+    static void release(FreeBlock* chain) noexcept
+    {
+        while (chain)
+        {
+            auto next = chain->next;
+            ::operator delete(chain, std::align_val_t(blockAlign));
+            chain = next;
+        }
+    }
+
+    struct Local;
+
+    struct Depot
+    {
+        std::mutex mutex;
+        std::vector<FreeBlock*> batches;
+
+        void take(Local& local)
+        {
+            auto lock = std::lock_guard(mutex);
+            if (!batches.empty())
+            {
+                local.head = batches.back();
+                local.count = batchSize;
+                batches.pop_back();
+            }
+        }
+
+        // Отрезает count блоков с головы локального списка
+        void give(Local& local, size_type count) noexcept
+        {
+            auto batch = local.head;
+            auto last = batch;
+            for (size_type i = 1; i < count; ++i)
+            {
+                last = last->next;
+            }
+            local.head = last->next;
+            local.count -= count;
+            last->next = nullptr;
+
+            auto lock = std::lock_guard(mutex);
+            if (batches.size() < depotLimit)
+            {
+                try
+                {
+                    batches.push_back(batch);
+                    return;
+                }
+                catch (...)
+                {
+                }
+            }
+            release(batch);
+        }
+    };
+
+    // При завершении потока его блоки целыми пачками уходят на склад
+    struct Local
+    {
+        FreeBlock* head{};
+        size_type count{};
+
+        ~Local()
+        {
+            localDestroyed = true;
+            while (count >= batchSize)
+            {
+                depot().give(*this, batchSize);
+            }
+            release(head);
+        }
+    };
+
+    // Склад не разрушается: узлы статических списков могут освобождаться
+    // уже после деструкторов других статических объектов
+    static auto depot() -> Depot&
+    {
+        static auto& shared = *new Depot();
+        return shared;
+    }
+
+    // Узлы, освобождаемые после разрушения кэша потока, идут напрямую в систему
+    static inline thread_local bool localDestroyed = false;
+
+    static auto localCache() noexcept -> Local&
+    {
+        thread_local auto local = Local();
+        return local;
+    }
+};
+
+// Распределитель без состояния поверх BlockCache. Одиночные объекты
+// (узел вместе с блоком управления) идут через кэш, массивы — мимо.
+template<typename T>
+class CachingAllocator
+{
+public:
+    using value_type = T;
+
+    CachingAllocator() = default;
+
+    template<typename U>
+    CachingAllocator(const CachingAllocator<U>&) noexcept
+    {
+    }
+
+    auto allocate(std::size_t count) -> T*
+    {
+        if (count == 1)
+        {
+            return static_cast<T*>(BlockCache<sizeof(T), alignof(T)>::allocate());
+        }
+        return std::allocator<T>().allocate(count);
+    }
+
+    void deallocate(T* pointer, std::size_t count) noexcept
+    {
+        if (count == 1)
+        {
+            BlockCache<sizeof(T), alignof(T)>::deallocate(pointer);
+            return;
+        }
+        std::allocator<T>().deallocate(pointer, count);
+    }
+
+    friend auto operator==(const CachingAllocator&, const CachingAllocator&) noexcept -> bool = default;
+};
+
+} // namespace mylist
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace mylist
+{
+
+// Пул блоков одного размера, нарезанных из крупных непрерывных кусков.
+// Блоки выдаются подряд, поэтому узлы, созданные один за другим, лежат рядом.
+// Кусок возвращается системе, когда освобождены все его блоки. Блоки можно
+// освобождать с любого потока, например потоком Reclaimer, поэтому учёт
+// кусков под мьютексом.
+class NodePool
+{
+public:
+    using size_type = std::size_t;
+
+    explicit NodePool(size_type blocksPerChunk) : mBlocksPerChunk(std::max<size_type>(blocksPerChunk, 1)) {}
+
+    NodePool(const NodePool&) = delete;
+    auto operator=(const NodePool&) -> NodePool& = delete;
+
+    ~NodePool()
+    {
+        for (auto& chunk : mChunks)
+        {
+            releaseChunk(chunk);
+        }
+    }
+
+    auto allocate(size_type bytes, size_type alignment) -> void*
+    {
+        auto lock = std::lock_guard(mMutex);
+        if (mBlockSize == 0)
+        {
+            mAlignment = std::max(alignment, alignof(std::max_align_t));
+            mBlockSize = (bytes + mAlignment - 1) / mAlignment * mAlignment;
+        }
+
+        if (bytes > mBlockSize || alignment > mAlignment)
+        {
+            throw std::bad_alloc();
+        }
+
+        if (mChunks.empty() || mChunks.back().used == mChunks.back().blocks)
+        {
+            addChunk();
+        }
+
+        auto& chunk = mChunks.back();
+        ++chunk.live;
+        return chunk.data + mBlockSize * chunk.used++;
+    }
+
+    void deallocate(void* pointer) noexcept
+    {
+        auto lock = std::lock_guard(mMutex);
+        auto it = findChunk(pointer);
+
+        if (--it->live == 0 && it->used == it->blocks)
+        {
+            releaseChunk(*it);
+            mChunks.erase(it);
+        }
+    }
+
+    // Занятые блоки во всех кусках
+    auto liveBlocks() const noexcept -> size_type
+    {
+        auto lock = std::lock_guard(mMutex);
+        auto count = size_type{};
+        for (const auto& chunk : mChunks)
+        {
+            count += chunk.live;
+        }
+        return count;
+    }
+
+    auto blockSize() const noexcept -> size_type
+    {
+        auto lock = std::lock_guard(mMutex);
+        return mBlockSize;
+    }
+
+    // Выдан ли блок с pointer этим пулом
+    auto owns(const void* pointer) const noexcept -> bool
+    {
+        auto lock = std::lock_guard(mMutex);
+        return findChunk(pointer) != mChunks.end();
+    }
+
+    // Выделенная пулом память, не занятая живыми блоками: свободные блоки
+    // кусков и массив учёта кусков. Сам объект пула сюда не входит
+    auto overheadBytes() const noexcept -> size_type
+    {
+        auto lock = std::lock_guard(mMutex);
+        auto bytes = mChunks.capacity() * sizeof(Chunk);
+        for (const auto& chunk : mChunks)
+        {
+            bytes += (chunk.blocks - chunk.live) * mBlockSize;
+        }
+        return bytes;
+    }
+
+private:
+    struct Chunk
+    {
+        std::byte* data;
+        size_type blocks;
+        size_type used;
+        size_type live;
+    };
+
+    size_type mBlocksPerChunk;
+    size_type mBlockSize{};
+    size_type mAlignment{};
+    std::vector<Chunk> mChunks;
+    mutable std::mutex mMutex;
+
+    auto findChunk(const void* pointer) const noexcept -> std::vector<Chunk>::const_iterator
+    {
+        auto block = static_cast<const std::byte*>(pointer);
+        return std::ranges::find_if(mChunks, [&](const Chunk& chunk) {
+            return !std::less<>()(block, chunk.data) && std::less<>()(block, chunk.data + mBlockSize * chunk.blocks);
+        });
+    }
+
+    auto findChunk(const void* pointer) noexcept -> std::vector<Chunk>::iterator
+    {
+        auto it = std::as_const(*this).findChunk(pointer);
+        return mChunks.begin() + (it - mChunks.cbegin());
+    }
+
+    void addChunk()
+    {
+        mChunks.reserve(mChunks.size() + 1);
+        auto data = static_cast<std::byte*>(
+            ::operator new(mBlockSize * mBlocksPerChunk, std::align_val_t(mAlignment)));
+        mChunks.push_back({data, mBlocksPerChunk, 0, 0});
+    }
+
+    void releaseChunk(Chunk& chunk) noexcept
+    {
+        ::operator delete(chunk.data, std::align_val_t(mAlignment));
+    }
+};
+
+// Аллокатор для allocate_shared: копии в блоках управления держат пул живым
+template<typename T>
+class PoolAllocator
+{
+    template<typename U>
+    friend class PoolAllocator;
+
+public:
+    using value_type = T;
+
+    explicit PoolAllocator(std::shared_ptr<NodePool> pool) noexcept : mPool(std::move(pool)) {}
+
+    template<typename U>
+    PoolAllocator(const PoolAllocator<U>& that) noexcept : mPool(that.mPool)
+    {
+    }
+
+    auto allocate(std::size_t count) -> T*
+    {
+        return static_cast<T*>(mPool->allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    void deallocate(T* pointer, std::size_t) noexcept
+    {
+        mPool->deallocate(pointer);
+    }
+
+    friend auto operator==(const PoolAllocator& lhs, const PoolAllocator& rhs) noexcept -> bool = default;
+
+private:
+    std::shared_ptr<NodePool> mPool;
+};
+
+} // namespace mylist
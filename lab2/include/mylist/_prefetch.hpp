@@ -0,0 +1,16 @@
+#pragma once
+
+namespace mylist
+{
+
+// Подсказка процессору заранее подгрузить строку кэша для чтения
+inline void prefetch(const void* address) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address, 0, 3);
+#else
+    static_cast<void>(address);
+#endif
+}
+
+} // namespace mylist
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace mylist
+{
+
+// Фоновое освобождение узлов. Список отдаёт сюда отцепленный узел или
+// целую цепочку, а разрушает их отдельный поток пачками, так что на
+// горячем потоке остаётся только постановка в очередь. Очередь ограничена:
+// когда она полна, цепочка освобождается сразу на вызывающем потоке.
+// Деструкторы элементов выполняются на потоке освобождения.
+class Reclaimer
+{
+public:
+    using size_type = std::size_t;
+
+    static constexpr size_type defaultCapacity = 1024;
+
+    explicit Reclaimer(size_type capacity = defaultCapacity)
+        : mQueue(capacity), mWakeThreshold(std::max<size_type>(capacity / 8, 1)),
+          mThread([this](std::stop_token stop) { run(stop); })
+    {
+    }
+
+    Reclaimer(const Reclaimer&) = delete;
+    auto operator=(const Reclaimer&) -> Reclaimer& = delete;
+
+    // Поток освобождения перед остановкой опустошает очередь
+    ~Reclaimer() = default;
+
+    // Цепочка, связанная владеющими указателями next; chain должен быть
+    // последним владельцем её головы. Поток освобождения будится пачкой
+    // в восьмую часть очереди, чтобы одиночные узлы не стоили переключения
+    // на каждый; wake будит его сразу, например ради длинной цепочки.
+    template<typename NodeType>
+    void retire(std::shared_ptr<NodeType>&& chain, bool wake = false) noexcept
+    {
+        if (!chain)
+        {
+            return;
+        }
+
+        auto queued = false;
+        try
+        {
+            auto lock = std::lock_guard(mMutex);
+            if (mCount < mQueue.size())
+            {
+                mQueue[(mFirst + mCount) % mQueue.size()] = {std::move(chain), &destroy<NodeType>};
+                queued = ++mCount == mWakeThreshold || wake;
+                ++mDeferred;
+            }
+            else
+            {
+                ++mInline;
+            }
+        }
+        catch (...)
+        {
+        }
+
+        if (chain)
+        {
+            destroy<NodeType>(chain);
+        }
+        else if (queued)
+        {
+            mWakeUp.notify_one();
+        }
+    }
+
+    // Ждёт, пока поток освобождения опустошит очередь
+    void drain()
+    {
+        auto lock = std::unique_lock(mMutex);
+        mWakeUp.notify_one();
+        mDrained.wait(lock, [this] { return mCount == 0 && !mBusy; });
+    }
+
+    auto capacity() const noexcept -> size_type
+    {
+        return mQueue.size();
+    }
+
+    // Цепочки, отданные фоновому потоку
+    auto deferred() const -> size_type
+    {
+        auto lock = std::lock_guard(mMutex);
+        return mDeferred;
+    }
+
+    // Цепочки, освобождённые на месте из-за переполнения очереди
+    auto reclaimedInline() const -> size_type
+    {
+        auto lock = std::lock_guard(mMutex);
+        return mInline;
+    }
+
+private:
+    struct Retired
+    {
+        std::shared_ptr<void> chain;
+        void (*destroy)(std::shared_ptr<void>&) noexcept = nullptr;
+    };
+
+    // Узлы освобождаются по одному, без рекурсии деструкторов shared_ptr
+    template<typename NodeType>
+    static void destroy(std::shared_ptr<void>& erased) noexcept
+    {
+        auto chain = std::static_pointer_cast<NodeType>(std::move(erased));
+        destroy<NodeType>(chain);
+    }
+
+    template<typename NodeType>
+    static void destroy(std::shared_ptr<NodeType>& chain) noexcept
+    {
+        while (chain)
+        {
+            chain = std::move(chain->next);
+        }
+    }
+
+    mutable std::mutex mMutex;
+    std::condition_variable_any mWakeUp;
+    std::condition_variable mDrained;
+    std::vector<Retired> mQueue; // кольцевой буфер
+    size_type mWakeThreshold;
+    size_type mFirst{};
+    size_type mCount{};
+    size_type mDeferred{};
+    size_type mInline{};
+    bool mBusy{};
+    std::jthread mThread;
+
+    void run(std::stop_token stop)
+    {
+        auto batch = std::vector<Retired>(mQueue.size());
+        auto lock = std::unique_lock(mMutex);
+        while (true)
+        {
+            if (!mWakeUp.wait(lock, stop, [this] { return mCount > 0; }))
+            {
+                return;
+            }
+
+            // Забираем всю очередь разом, освобождаем без блокировки
+            auto taken = mCount;
+            for (size_type i = 0; i < taken; ++i)
+            {
+                batch[i] = std::move(mQueue[(mFirst + i) % mQueue.size()]);
+            }
+            mFirst = (mFirst + taken) % mQueue.size();
+            mCount = 0;
+            mBusy = true;
+
+            lock.unlock();
+            for (size_type i = 0; i < taken; ++i)
+            {
+                batch[i].destroy(batch[i].chain);
+            }
+            lock.lock();
+
+            mBusy = false;
+            if (mCount == 0)
+            {
+                mDrained.notify_all();
+            }
+        }
+    }
+};
+
+} // namespace mylist
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+namespace mylist
+{
+
+// Результат операций try* — тех же проверок, что бросают исключения из
+// _exceptions.hpp, но возвращающих ошибку значением
+enum class Status
+{
+    ok,
+    outOfRange,       // как ListOutOfRangeException
+    danglingIterator, // как DanglingIteratorException
+    outOfMemory,      // распределитель бросил std::bad_alloc
+};
+
+// Значение или причина, по которой его нет; урезанный std::expected<V, Status> из C++23
+template<std::default_initializable V>
+class Expected
+{
+public:
+    Expected(V value) noexcept(std::is_nothrow_move_constructible_v<V>) : mValue(std::move(value)) {}
+
+    Expected(Status status) noexcept : mStatus(status) {}
+
+    auto has_value() const noexcept -> bool
+    {
+        return mStatus == Status::ok;
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return has_value();
+    }
+
+    auto status() const noexcept -> Status
+    {
+        return mStatus;
+    }
+
+    // Без проверки, как у std::expected: сначала has_value()
+    auto operator*() noexcept -> V&
+    {
+        return mValue;
+    }
+
+    auto operator*() const noexcept -> const V&
+    {
+        return mValue;
+    }
+
+    auto operator->() noexcept -> V*
+    {
+        return &mValue;
+    }
+
+    auto operator->() const noexcept -> const V*
+    {
+        return &mValue;
+    }
+
+private:
+    V mValue{};
+    Status mStatus{Status::ok};
+};
+
+} // namespace mylist
@@ -0,0 +1,197 @@
+#pragma once
+
+#include "executor.hpp"
+#include "list.hpp"
+#include <coroutine>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+namespace mylist
+{
+
+// Ограниченный канал между корутинами поверх List.
+// Читатель приостанавливается на пустом канале, писатель — на заполненном,
+// разбуженные корутины ставятся в очередь Executor.
+template<typename T>
+class Channel
+{
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    class PushAwaiter;
+    class PopAwaiter;
+
+    Channel(Executor& executor, size_type capacity) : mExecutor(executor), mCapacity(capacity) {}
+
+    Channel(const Channel&) = delete;
+    auto operator=(const Channel&) -> Channel& = delete;
+
+    // co_await возвращает false, если канал закрыт
+    auto push(std::convertible_to<value_type> auto&& value) -> PushAwaiter
+    {
+        return PushAwaiter(*this, value_type(std::forward<decltype(value)>(value)));
+    }
+
+    // co_await возвращает std::nullopt, если канал закрыт и пуст
+    auto pop() -> PopAwaiter
+    {
+        return PopAwaiter(*this);
+    }
+
+    auto tryPush(std::convertible_to<value_type> auto&& value) -> bool
+    {
+        auto awaiter = push(std::forward<decltype(value)>(value));
+        return awaiter.await_ready() && awaiter.await_resume();
+    }
+
+    auto tryPop() -> std::optional<value_type>
+    {
+        auto awaiter = pop();
+        if (!awaiter.await_ready())
+        {
+            return {};
+        }
+        return awaiter.await_resume();
+    }
+
+    // Будит все ожидающие корутины, дальнейшие push завершаются неудачей
+    void close()
+    {
+        mClosed = true;
+        while (auto popper = mPoppers.popHead())
+        {
+            mExecutor.schedule((*popper)->mHandle);
+        }
+        while (auto pusher = mPushers.popHead())
+        {
+            mExecutor.schedule((*pusher)->mHandle);
+        }
+    }
+
+    auto closed() const noexcept -> bool
+    {
+        return mClosed;
+    }
+
+    auto size() const noexcept -> size_type
+    {
+        return mBuffer.size();
+    }
+
+    auto empty() const noexcept -> bool
+    {
+        return mBuffer.empty();
+    }
+
+    auto full() const noexcept -> bool
+    {
+        return mBuffer.size() >= mCapacity;
+    }
+
+    auto capacity() const noexcept -> size_type
+    {
+        return mCapacity;
+    }
+
+    class PushAwaiter
+    {
+        friend class Channel;
+    public:
+        auto await_ready() -> bool
+        {
+            if (mChannel.mClosed)
+            {
+                return true;
+            }
+
+            if (auto popper = mChannel.mPoppers.popHead())
+            {
+                (*popper)->mValue = std::move(mValue);
+                mChannel.mExecutor.schedule((*popper)->mHandle);
+                mPushed = true;
+            }
+            else if (!mChannel.full())
+            {
+                mChannel.mBuffer.pushTail(std::move(mValue));
+                mPushed = true;
+            }
+            return mPushed;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            mHandle = handle;
+            mChannel.mPushers.pushTail(this);
+        }
+
+        auto await_resume() const noexcept -> bool
+        {
+            return mPushed;
+        }
+
+    private:
+        Channel& mChannel;
+        value_type mValue;
+        std::coroutine_handle<> mHandle{};
+        bool mPushed{};
+
+        PushAwaiter(Channel& channel, value_type&& value) : mChannel(channel), mValue(std::move(value)) {}
+    };
+
+    class PopAwaiter
+    {
+        friend class Channel;
+    public:
+        auto await_ready() -> bool
+        {
+            if (!mChannel.mBuffer.empty())
+            {
+                mValue = mChannel.mBuffer.popHead();
+                if (auto pusher = mChannel.mPushers.popHead())
+                {
+                    mChannel.mBuffer.pushTail(std::move((*pusher)->mValue));
+                    (*pusher)->mPushed = true;
+                    mChannel.mExecutor.schedule((*pusher)->mHandle);
+                }
+            }
+            else if (auto pusher = mChannel.mPushers.popHead())
+            {
+                // Канал нулевой ёмкости: значение передаётся напрямую
+                mValue = std::move((*pusher)->mValue);
+                (*pusher)->mPushed = true;
+                mChannel.mExecutor.schedule((*pusher)->mHandle);
+            }
+            return mValue.has_value() || mChannel.mClosed;
+        }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            mHandle = handle;
+            mChannel.mPoppers.pushTail(this);
+        }
+
+        auto await_resume() -> std::optional<value_type>
+        {
+            return std::move(mValue);
+        }
+
+    private:
+        Channel& mChannel;
+        std::optional<value_type> mValue{};
+        std::coroutine_handle<> mHandle{};
+
+        explicit PopAwaiter(Channel& channel) : mChannel(channel) {}
+    };
+
+private:
+    Executor& mExecutor;
+    size_type mCapacity;
+    bool mClosed{};
+    List<value_type> mBuffer;
+    List<PushAwaiter*> mPushers;
+    List<PopAwaiter*> mPoppers;
+};
+
+} // namespace mylist
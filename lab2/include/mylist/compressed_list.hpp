@@ -0,0 +1,489 @@
+#pragma once
+
+#include "_exceptions.hpp"
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <ostream>
+#include <vector>
+
+namespace mylist
+{
+
+// Сжатый список целых. Значения хранятся кусками до chunkCapacity штук:
+// первое и последнее значение куска явно, остальные — разностями соседей
+// в zigzag-varint, так что возрастающие идентификаторы с небольшими
+// шагами занимают около байта на элемент. Итераторы только читают и
+// раскодируют значения на ходу в обе стороны; любое изменение списка
+// делает их недействительными.
+template<std::integral T>
+class CompressedList
+{
+    struct Chunk
+    {
+        T first;
+        T last;
+        std::uint32_t count;
+        std::vector<std::uint8_t> deltas;
+    };
+
+public:
+    using value_type = T;
+    using reference = value_type;
+    using const_reference = value_type;
+    using size_type = std::size_t;
+
+    static constexpr std::uint32_t chunkCapacity = 128;
+
+    class const_iterator
+    {
+        friend class CompressedList;
+    public:
+        // Значение возвращается по копии, но std::prev и reverse_iterator
+        // с такими итераторами работают
+        using iterator_category = std::bidirectional_iterator_tag;
+        using iterator_concept = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        const_iterator() = default;
+
+        auto operator++() -> const_iterator&
+        {
+            const auto& chunk = mList->mChunks[mChunk];
+            if (mIndex + 1 < chunk.count)
+            {
+                mValue = applyDelta(mValue, readVarint(chunk.deltas, mPos));
+                ++mIndex;
+            }
+            else
+            {
+                ++mChunk;
+                loadFront();
+            }
+            return *this;
+        }
+
+        auto operator++(int) -> const_iterator
+        {
+            auto oldIt = *this;
+            ++(*this);
+            return oldIt;
+        }
+
+        auto operator--() -> const_iterator&
+        {
+            if (mChunk < mList->mChunks.size() && mIndex > 0)
+            {
+                const auto& chunk = mList->mChunks[mChunk];
+                auto start = varintStart(chunk.deltas, mPos);
+                auto pos = start;
+                mValue = revertDelta(mValue, readVarint(chunk.deltas, pos));
+                mPos = start;
+                --mIndex;
+            }
+            else
+            {
+                --mChunk;
+                loadBack();
+            }
+            return *this;
+        }
+
+        auto operator--(int) -> const_iterator
+        {
+            auto oldIt = *this;
+            --(*this);
+            return oldIt;
+        }
+
+        auto operator*() const -> reference
+        {
+            if (mList == nullptr || mChunk >= mList->mChunks.size())
+            {
+                throw ListOutOfRangeException("Trying to dereference the end of the list");
+            }
+            return mValue;
+        }
+
+        friend auto operator==(const const_iterator& lhs, const const_iterator& rhs) -> bool
+        {
+            return lhs.mList == rhs.mList && lhs.mChunk == rhs.mChunk && lhs.mIndex == rhs.mIndex;
+        }
+
+    private:
+        const CompressedList* mList{};
+        size_type mChunk{};
+        std::size_t mPos{}; // конец varint, из которого получено текущее значение
+        std::uint32_t mIndex{};
+        T mValue{};
+
+        const_iterator(const CompressedList* list, size_type chunk) : mList(list), mChunk(chunk)
+        {
+            loadFront();
+        }
+
+        void loadFront() noexcept
+        {
+            mPos = 0;
+            mIndex = 0;
+            if (mChunk < mList->mChunks.size())
+            {
+                mValue = mList->mChunks[mChunk].first;
+            }
+        }
+
+        void loadBack() noexcept
+        {
+            const auto& chunk = mList->mChunks[mChunk];
+            mValue = chunk.last;
+            mPos = chunk.deltas.size();
+            mIndex = chunk.count - 1;
+        }
+    };
+
+    using iterator = const_iterator;
+    using reverse_iterator = std::reverse_iterator<const_iterator>;
+    using const_reverse_iterator = reverse_iterator;
+
+    CompressedList() = default;
+    CompressedList(std::initializer_list<value_type> list);
+
+    template<std::input_iterator It>
+    CompressedList(It begin, It end)
+        requires std::convertible_to<std::iter_value_t<It>, value_type>;
+
+    auto peekHead() const -> value_type;
+    auto peekTail() const -> value_type;
+
+    auto popHead() -> std::optional<value_type>;
+    auto popTail() -> std::optional<value_type>;
+
+    void pushHead(value_type element);
+    void pushTail(value_type element);
+
+    // Псевдоним `pushHead` для совместимости с front_inserter
+    void push_front(value_type element);
+
+    // Псевдоним `pushTail` для совместимости с back_inserter
+    void push_back(value_type element);
+
+    void clear() noexcept;
+
+    auto size() const noexcept -> size_type
+    {
+        return mLen;
+    }
+
+    auto empty() const noexcept -> bool
+    {
+        return mLen == 0;
+    }
+
+    // Байты, занятые кусками и их разностями
+    auto storageBytes() const noexcept -> size_type;
+
+    // Сравнение значений в порядке обхода
+    friend auto operator==(const CompressedList& lhs, const CompressedList& rhs) -> bool
+    {
+        return lhs.size() == rhs.size() && std::ranges::equal(lhs, rhs);
+    }
+
+    auto begin() const noexcept -> const_iterator
+    {
+        return cbegin();
+    }
+
+    auto end() const noexcept -> const_iterator
+    {
+        return cend();
+    }
+
+    auto cbegin() const noexcept -> const_iterator
+    {
+        return const_iterator(this, 0);
+    }
+
+    auto cend() const noexcept -> const_iterator
+    {
+        return const_iterator(this, mChunks.size());
+    }
+
+    auto rbegin() const noexcept -> const_reverse_iterator
+    {
+        return crbegin();
+    }
+
+    auto rend() const noexcept -> const_reverse_iterator
+    {
+        return crend();
+    }
+
+    auto crbegin() const noexcept -> const_reverse_iterator
+    {
+        return const_reverse_iterator(cend());
+    }
+
+    auto crend() const noexcept -> const_reverse_iterator
+    {
+        return const_reverse_iterator(cbegin());
+    }
+
+private:
+    std::deque<Chunk> mChunks;
+    size_type mLen{};
+
+    // Разности считаются по модулю 2^64, поэтому переполнения не страшны
+    static auto delta(value_type from, value_type to) noexcept -> std::uint64_t
+    {
+        auto difference = static_cast<std::int64_t>(static_cast<std::uint64_t>(to) - static_cast<std::uint64_t>(from));
+        return (static_cast<std::uint64_t>(difference) << 1) ^ static_cast<std::uint64_t>(difference >> 63);
+    }
+
+    static auto unzigzag(std::uint64_t encoded) noexcept -> std::uint64_t
+    {
+        return (encoded >> 1) ^ (~(encoded & 1) + 1);
+    }
+
+    static auto applyDelta(value_type from, std::uint64_t encoded) noexcept -> value_type
+    {
+        return static_cast<value_type>(static_cast<std::uint64_t>(from) + unzigzag(encoded));
+    }
+
+    static auto revertDelta(value_type to, std::uint64_t encoded) noexcept -> value_type
+    {
+        return static_cast<value_type>(static_cast<std::uint64_t>(to) - unzigzag(encoded));
+    }
+
+    using Encoded = std::array<std::uint8_t, 10>;
+
+    static auto writeVarint(Encoded& out, std::uint64_t value) noexcept -> std::size_t
+    {
+        auto length = std::size_t{};
+        while (value >= 0x80)
+        {
+            out[length++] = static_cast<std::uint8_t>(value | 0x80);
+            value >>= 7;
+        }
+        out[length++] = static_cast<std::uint8_t>(value);
+        return length;
+    }
+
+    static auto readVarint(const std::vector<std::uint8_t>& bytes, std::size_t& pos) noexcept -> std::uint64_t
+    {
+        auto value = std::uint64_t{};
+        for (unsigned shift = 0;; shift += 7)
+        {
+            auto byte = bytes[pos++];
+            value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return value;
+            }
+        }
+    }
+
+    // Начало varint, который заканчивается перед end: у всех его байтов,
+    // кроме последнего, выставлен старший бит
+    static auto varintStart(const std::vector<std::uint8_t>& bytes, std::size_t end) noexcept -> std::size_t
+    {
+        auto start = end - 1;
+        while (start > 0 && (bytes[start - 1] & 0x80) != 0)
+        {
+            --start;
+        }
+        return start;
+    }
+
+    // Заполненный кусок больше не растёт, лишняя ёмкость ему не нужна
+    static void seal(Chunk& chunk)
+    {
+        chunk.deltas.shrink_to_fit();
+    }
+};
+
+template<std::integral T>
+CompressedList<T>::CompressedList(std::initializer_list<value_type> list) : CompressedList(list.begin(), list.end())
+{
+}
+
+template<std::integral T>
+template<std::input_iterator It>
+CompressedList<T>::CompressedList(It begin, It end)
+    requires std::convertible_to<std::iter_value_t<It>, value_type>
+{
+    for (; begin != end; ++begin)
+    {
+        pushTail(*begin);
+    }
+}
+
+template<std::integral T>
+auto CompressedList<T>::peekHead() const -> value_type
+{
+    if (empty())
+    {
+        throw ListOutOfRangeException("peekHead() called on an empty list");
+    }
+    return mChunks.front().first;
+}
+
+template<std::integral T>
+auto CompressedList<T>::peekTail() const -> value_type
+{
+    if (empty())
+    {
+        throw ListOutOfRangeException("peekTail() called on an empty list");
+    }
+    return mChunks.back().last;
+}
+
+template<std::integral T>
+auto CompressedList<T>::popHead() -> std::optional<value_type>
+{
+    if (empty())
+    {
+        return {};
+    }
+
+    auto& chunk = mChunks.front();
+    auto value = chunk.first;
+    if (chunk.count == 1)
+    {
+        mChunks.pop_front();
+    }
+    else
+    {
+        auto pos = std::size_t{};
+        chunk.first = applyDelta(chunk.first, readVarint(chunk.deltas, pos));
+        chunk.deltas.erase(chunk.deltas.begin(), chunk.deltas.begin() + static_cast<std::ptrdiff_t>(pos));
+        --chunk.count;
+    }
+    --mLen;
+    return value;
+}
+
+template<std::integral T>
+auto CompressedList<T>::popTail() -> std::optional<value_type>
+{
+    if (empty())
+    {
+        return {};
+    }
+
+    auto& chunk = mChunks.back();
+    auto value = chunk.last;
+    if (chunk.count == 1)
+    {
+        mChunks.pop_back();
+    }
+    else
+    {
+        auto start = varintStart(chunk.deltas, chunk.deltas.size());
+        auto pos = start;
+        chunk.last = revertDelta(chunk.last, readVarint(chunk.deltas, pos));
+        chunk.deltas.resize(start);
+        --chunk.count;
+    }
+    --mLen;
+    return value;
+}
+
+template<std::integral T>
+void CompressedList<T>::pushHead(value_type element)
+{
+    if (mChunks.empty() || mChunks.front().count == chunkCapacity)
+    {
+        if (!mChunks.empty())
+        {
+            seal(mChunks.front());
+        }
+        mChunks.push_front({element, element, 1, {}});
+    }
+    else
+    {
+        auto& chunk = mChunks.front();
+        auto encoded = Encoded();
+        auto length = writeVarint(encoded, delta(element, chunk.first));
+        chunk.deltas.insert(chunk.deltas.begin(), encoded.begin(), encoded.begin() + length);
+        chunk.first = element;
+        ++chunk.count;
+    }
+    ++mLen;
+}
+
+template<std::integral T>
+void CompressedList<T>::pushTail(value_type element)
+{
+    if (mChunks.empty() || mChunks.back().count == chunkCapacity)
+    {
+        if (!mChunks.empty())
+        {
+            seal(mChunks.back());
+        }
+        mChunks.push_back({element, element, 1, {}});
+    }
+    else
+    {
+        auto& chunk = mChunks.back();
+        auto encoded = Encoded();
+        auto length = writeVarint(encoded, delta(chunk.last, element));
+        chunk.deltas.insert(chunk.deltas.end(), encoded.begin(), encoded.begin() + length);
+        chunk.last = element;
+        ++chunk.count;
+    }
+    ++mLen;
+}
+
+template<std::integral T>
+void CompressedList<T>::push_front(value_type element)
+{
+    pushHead(element);
+}
+
+template<std::integral T>
+void CompressedList<T>::push_back(value_type element)
+{
+    pushTail(element);
+}
+
+template<std::integral T>
+void CompressedList<T>::clear() noexcept
+{
+    mChunks.clear();
+    mLen = 0;
+}
+
+template<std::integral T>
+auto CompressedList<T>::storageBytes() const noexcept -> size_type
+{
+    auto bytes = mChunks.size() * sizeof(Chunk);
+    for (const auto& chunk : mChunks)
+    {
+        bytes += chunk.deltas.capacity();
+    }
+    return bytes;
+}
+
+template<std::integral T>
+auto operator<<(std::ostream& os, const CompressedList<T>& ls) -> std::ostream&
+{
+    os << "[";
+    for (auto separator = ""; auto element : ls)
+    {
+        os << separator << +element;
+        separator = ", ";
+    }
+    os << "]";
+    return os;
+}
+
+} // namespace mylist
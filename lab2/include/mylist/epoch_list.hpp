@@ -0,0 +1,253 @@
+#pragma once
+
+#include "_epoch.hpp"
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <utility>
+
+namespace mylist
+{
+
+// Список для одного писателя и многих читателей.
+// Связи вперёд атомарные, поэтому читатели обходят список без блокировок
+// внутри read(); удалённые писателем узлы освобождаются через EpochDomain.
+template<typename T>
+class EpochList
+{
+    struct EpochNode
+    {
+        T value;
+        std::atomic<EpochNode*> next{};
+        EpochNode* prev{};
+
+        template<typename... Args>
+        explicit EpochNode(Args&&... args) : value(std::forward<Args>(args)...)
+        {
+        }
+    };
+
+public:
+    using value_type = T;
+    using const_reference = const value_type&;
+    using size_type = std::size_t;
+
+    class ConstIterator
+    {
+        friend class EpochList;
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using iterator_concept = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        ConstIterator() = default;
+
+        auto operator++() -> ConstIterator&
+        {
+            mNode = mNode->next.load(std::memory_order_acquire);
+            return *this;
+        }
+
+        auto operator++(int) -> ConstIterator
+        {
+            auto oldIt = *this;
+            ++(*this);
+            return oldIt;
+        }
+
+        auto operator*() const -> reference
+        {
+            return mNode->value;
+        }
+
+        auto operator->() const -> pointer
+        {
+            return &mNode->value;
+        }
+
+        friend auto operator==(const ConstIterator& lhs, const ConstIterator& rhs) -> bool = default;
+
+    private:
+        const EpochNode* mNode{};
+
+        explicit ConstIterator(const EpochNode* node) : mNode(node) {}
+    };
+
+    // Критическая секция читателя: пока она жива, узлы не освобождаются
+    class ReadView
+    {
+        friend class EpochList;
+    public:
+        auto begin() const -> ConstIterator
+        {
+            return ConstIterator(mList->mHead.load(std::memory_order_acquire));
+        }
+
+        auto end() const -> ConstIterator
+        {
+            return ConstIterator();
+        }
+
+    private:
+        EpochDomain::Guard mGuard;
+        const EpochList* mList;
+
+        ReadView(EpochDomain::Guard&& guard, const EpochList* list) : mGuard(std::move(guard)), mList(list) {}
+    };
+
+    using const_iterator = ConstIterator;
+
+    EpochList() = default;
+    EpochList(const EpochList&) = delete;
+    auto operator=(const EpochList&) -> EpochList& = delete;
+
+    ~EpochList()
+    {
+        clear();
+    }
+
+    // Безопасно вызывать из любого потока
+    auto read() const -> ReadView
+    {
+        return ReadView(mDomain.pin(), this);
+    }
+
+    auto size() const noexcept -> size_type
+    {
+        return mLen.load(std::memory_order_relaxed);
+    }
+
+    auto empty() const noexcept -> bool
+    {
+        return size() == 0;
+    }
+
+    // Дальше — только для потока-писателя
+
+    void pushHead(std::convertible_to<value_type> auto&& element)
+    {
+        auto node = new EpochNode(std::forward<decltype(element)>(element));
+        auto head = mHead.load(std::memory_order_relaxed);
+        node->next.store(head, std::memory_order_relaxed);
+        if (head)
+        {
+            head->prev = node;
+        }
+        else
+        {
+            mTail = node;
+        }
+        mHead.store(node, std::memory_order_release);
+        mLen.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void pushTail(std::convertible_to<value_type> auto&& element)
+    {
+        auto node = new EpochNode(std::forward<decltype(element)>(element));
+        node->prev = mTail;
+        if (mTail)
+        {
+            mTail->next.store(node, std::memory_order_release);
+        }
+        else
+        {
+            mHead.store(node, std::memory_order_release);
+        }
+        mTail = node;
+        mLen.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Значение копируется: узел остаётся доступен читателям до освобождения
+    auto popHead() -> std::optional<value_type>
+    {
+        auto node = mHead.load(std::memory_order_relaxed);
+        if (!node)
+        {
+            return {};
+        }
+
+        auto next = node->next.load(std::memory_order_relaxed);
+        mHead.store(next, std::memory_order_release);
+        if (next)
+        {
+            next->prev = nullptr;
+        }
+        else
+        {
+            mTail = nullptr;
+        }
+        mLen.fetch_sub(1, std::memory_order_relaxed);
+
+        auto data = std::optional<value_type>(node->value);
+        retire(node);
+        return data;
+    }
+
+    auto popTail() -> std::optional<value_type>
+    {
+        auto node = mTail;
+        if (!node)
+        {
+            return {};
+        }
+
+        mTail = node->prev;
+        if (mTail)
+        {
+            mTail->next.store(nullptr, std::memory_order_release);
+        }
+        else
+        {
+            mHead.store(nullptr, std::memory_order_release);
+        }
+        mLen.fetch_sub(1, std::memory_order_relaxed);
+
+        auto data = std::optional<value_type>(node->value);
+        retire(node);
+        return data;
+    }
+
+    void clear()
+    {
+        auto node = mHead.exchange(nullptr, std::memory_order_acq_rel);
+        mTail = nullptr;
+        mLen.store(0, std::memory_order_relaxed);
+
+        while (node)
+        {
+            auto next = node->next.load(std::memory_order_relaxed);
+            retire(node);
+            node = next;
+        }
+    }
+
+    // Освобождает всё, что больше не видят читатели
+    void collect()
+    {
+        mDomain.collect();
+    }
+
+    // Количество узлов, ожидающих освобождения
+    auto pendingReclamation() const noexcept -> size_type
+    {
+        return mDomain.pending();
+    }
+
+private:
+    mutable EpochDomain mDomain;
+    std::atomic<EpochNode*> mHead{};
+    EpochNode* mTail{};
+    std::atomic<size_type> mLen{};
+
+    void retire(EpochNode* node)
+    {
+        mDomain.retire(node, [](void* pointer) { delete static_cast<EpochNode*>(pointer); });
+    }
+};
+
+} // namespace mylist
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "list.hpp"
+#include <algorithm>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <utility>
+#include <vector>
+
+namespace mylist
+{
+
+// Корутина без результата, запускаемая через Executor
+class Task
+{
+public:
+    struct promise_type
+    {
+        std::exception_ptr exception{};
+
+        auto get_return_object() noexcept -> Task
+        {
+            return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        auto initial_suspend() const noexcept -> std::suspend_always
+        {
+            return {};
+        }
+
+        auto final_suspend() const noexcept -> std::suspend_always
+        {
+            return {};
+        }
+
+        void return_void() const noexcept {}
+
+        void unhandled_exception() noexcept
+        {
+            exception = std::current_exception();
+        }
+    };
+
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    Task() = default;
+
+    Task(const Task&) = delete;
+    auto operator=(const Task&) -> Task& = delete;
+
+    Task(Task&& that) noexcept : mHandle(std::exchange(that.mHandle, {})) {}
+
+    auto operator=(Task&& that) noexcept -> Task&
+    {
+        if (this != &that)
+        {
+            Task(std::move(that)).swap(*this);
+        }
+        return *this;
+    }
+
+    ~Task()
+    {
+        if (mHandle)
+        {
+            mHandle.destroy();
+        }
+    }
+
+    void swap(Task& that) noexcept
+    {
+        std::swap(mHandle, that.mHandle);
+    }
+
+    auto handle() const noexcept -> handle_type
+    {
+        return mHandle;
+    }
+
+    auto done() const noexcept -> bool
+    {
+        return !mHandle || mHandle.done();
+    }
+
+private:
+    handle_type mHandle{};
+
+    explicit Task(handle_type handle) noexcept : mHandle(handle) {}
+};
+
+// Однопоточный планировщик: выполняет готовые корутины по очереди
+class Executor
+{
+public:
+    using size_type = std::size_t;
+
+    Executor() = default;
+    Executor(const Executor&) = delete;
+    auto operator=(const Executor&) -> Executor& = delete;
+
+    void spawn(Task task)
+    {
+        schedule(task.handle());
+        mTasks.push_back(std::move(task));
+    }
+
+    void schedule(std::coroutine_handle<> handle)
+    {
+        mReady.pushTail(handle);
+    }
+
+    // Выполняет одну готовую корутину, возвращает false, если очередь пуста
+    auto runOne() -> bool
+    {
+        auto handle = mReady.popHead();
+        if (!handle)
+        {
+            return false;
+        }
+
+        handle->resume();
+        if (handle->done())
+        {
+            reap(*handle);
+        }
+        return true;
+    }
+
+    void run()
+    {
+        while (runOne())
+        {
+        }
+    }
+
+    // Количество незавершённых задач, включая приостановленные
+    auto pending() const noexcept -> size_type
+    {
+        return mTasks.size();
+    }
+
+private:
+    List<std::coroutine_handle<>> mReady;
+    std::vector<Task> mTasks;
+
+    void reap(std::coroutine_handle<> handle)
+    {
+        auto it = std::ranges::find(mTasks, handle.address(), [](const Task& task) { return task.handle().address(); });
+        if (it == mTasks.end())
+        {
+            return;
+        }
+
+        auto finished = std::move(*it);
+        *it = std::move(mTasks.back());
+        mTasks.pop_back();
+
+        if (auto exception = finished.handle().promise().exception)
+        {
+            std::rethrow_exception(exception);
+        }
+    }
+};
+
+} // namespace mylist
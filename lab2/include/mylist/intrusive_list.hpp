@@ -0,0 +1,525 @@
+#pragma once
+
+#include "_exceptions.hpp"
+#include "list.hpp"
+#include <cstddef>
+#include <iterator>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+
+namespace mylist
+{
+
+class IntrusiveListCore;
+
+// Поле-крючок, которое элемент встраивает в себя, чтобы состоять в IntrusiveList.
+// Копирование объекта не копирует членство, разрушение — исключает из списка.
+class ListHook
+{
+    friend class IntrusiveListCore;
+
+    template<typename T, ListHook T::*Hook>
+    friend class IntrusiveList;
+
+public:
+    ListHook() = default;
+
+    ListHook(const ListHook&) noexcept {}
+
+    auto operator=(const ListHook&) noexcept -> ListHook&
+    {
+        return *this;
+    }
+
+    ~ListHook()
+    {
+        unlink();
+    }
+
+    auto linked() const noexcept -> bool;
+
+    // Исключает элемент из списка за O(1), не зная самого списка
+    void unlink() noexcept;
+
+private:
+    ListHook* mPrev{};
+    ListHook* mNext{};
+    IntrusiveListCore* mOwner{};
+
+    auto sentinel() const noexcept -> bool;
+};
+
+// Нешаблонная часть: кольцо из крючков вокруг фиктивного sentinel
+class IntrusiveListCore : public ListBase
+{
+    friend class ListHook;
+
+public:
+    IntrusiveListCore() noexcept
+    {
+        reset();
+    }
+
+    IntrusiveListCore(const IntrusiveListCore&) = delete;
+    auto operator=(const IntrusiveListCore&) -> IntrusiveListCore& = delete;
+
+    ~IntrusiveListCore() override
+    {
+        clear();
+    }
+
+    // Исключает все элементы, сами объекты не разрушаются
+    void clear() noexcept
+    {
+        auto hook = mSentinel.mNext;
+        while (hook != &mSentinel)
+        {
+            auto next = hook->mNext;
+            hook->mPrev = hook->mNext = nullptr;
+            hook->mOwner = nullptr;
+            hook = next;
+        }
+        reset();
+    }
+
+protected:
+    ListHook mSentinel;
+
+    void reset() noexcept
+    {
+        mSentinel.mPrev = mSentinel.mNext = &mSentinel;
+        mSentinel.mOwner = this;
+        mLen = 0;
+    }
+
+    void linkBefore(ListHook* position, ListHook* hook) noexcept
+    {
+        hook->mPrev = position->mPrev;
+        hook->mNext = position;
+        hook->mOwner = this;
+        position->mPrev->mNext = hook;
+        position->mPrev = hook;
+        ++mLen;
+    }
+
+    // Переносит все элементы that в конец, владельцев обновляет за O(that.size())
+    void spliceAll(IntrusiveListCore& that) noexcept
+    {
+        if (that.mLen == 0)
+        {
+            return;
+        }
+
+        for (auto hook = that.mSentinel.mNext; hook != &that.mSentinel; hook = hook->mNext)
+        {
+            hook->mOwner = this;
+        }
+
+        auto first = that.mSentinel.mNext;
+        auto last = that.mSentinel.mPrev;
+        first->mPrev = mSentinel.mPrev;
+        mSentinel.mPrev->mNext = first;
+        last->mNext = &mSentinel;
+        mSentinel.mPrev = last;
+        mLen += that.mLen;
+
+        that.reset();
+    }
+};
+
+inline auto ListHook::sentinel() const noexcept -> bool
+{
+    return mOwner != nullptr && &mOwner->mSentinel == this;
+}
+
+inline auto ListHook::linked() const noexcept -> bool
+{
+    return mOwner != nullptr && !sentinel();
+}
+
+inline void ListHook::unlink() noexcept
+{
+    if (!linked())
+    {
+        return;
+    }
+
+    mPrev->mNext = mNext;
+    mNext->mPrev = mPrev;
+    --mOwner->mLen;
+    mPrev = mNext = nullptr;
+    mOwner = nullptr;
+}
+
+// Интрузивный двусвязный список: узлом служит ListHook внутри элемента,
+// поэтому вставка и удаление никогда не выделяют память.
+// Список не владеет элементами.
+template<typename T, ListHook T::*Hook>
+class IntrusiveList : public IntrusiveListCore
+{
+    template<bool Const>
+    class BasicIterator
+    {
+        friend class IntrusiveList;
+        friend class BasicIterator<!Const>;
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using iterator_concept = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+        using reference = std::conditional_t<Const, const value_type&, value_type&>;
+
+        BasicIterator() = default;
+
+        template<bool OtherConst>
+        BasicIterator(const BasicIterator<OtherConst>& that)
+            requires(Const && !OtherConst)
+            : mHook(that.mHook)
+        {
+        }
+
+        auto operator++() -> BasicIterator&
+        {
+            validateIterator();
+            mHook = mHook->mNext;
+            return *this;
+        }
+
+        auto operator++(int) -> BasicIterator
+        {
+            auto oldIt = *this;
+            ++(*this);
+            return oldIt;
+        }
+
+        auto operator--() -> BasicIterator&
+        {
+            validateIterator();
+            mHook = mHook->mPrev;
+            return *this;
+        }
+
+        auto operator--(int) -> BasicIterator
+        {
+            auto oldIt = *this;
+            --(*this);
+            return oldIt;
+        }
+
+        auto operator*() const -> reference
+        {
+            validateIterator();
+            if (mHook->sentinel())
+            {
+                throw ListOutOfRangeException("Trying to dereference the end of the list");
+            }
+            return *fromHook(mHook);
+        }
+
+        auto operator->() const -> pointer
+        {
+            return &**this;
+        }
+
+        friend auto operator==(const BasicIterator& lhs, const BasicIterator& rhs) -> bool
+        {
+            return lhs.mHook == rhs.mHook;
+        }
+
+        auto dangling() const noexcept -> bool
+        {
+            return mHook == nullptr || mHook->mOwner == nullptr;
+        }
+
+    private:
+        ListHook* mHook{};
+
+        explicit BasicIterator(ListHook* hook) : mHook(hook) {}
+
+        auto validateIterator() const -> void
+        {
+            if (dangling())
+            {
+                throw DanglingIteratorException("Trying to dereference dangling iterator");
+            }
+        }
+    };
+
+public:
+    using value_type = T;
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using size_type = ListBase::size_type;
+
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    IntrusiveList() = default;
+
+    template<std::input_iterator It>
+    IntrusiveList(It begin, It end)
+        requires std::same_as<std::iter_reference_t<It>, reference>
+    {
+        for (; begin != end; ++begin)
+        {
+            pushTail(*begin);
+        }
+    }
+
+    IntrusiveList(IntrusiveList&& that) noexcept
+    {
+        spliceAll(that);
+    }
+
+    auto operator=(IntrusiveList&& that) noexcept -> IntrusiveList&
+    {
+        if (this != &that)
+        {
+            clear();
+            spliceAll(that);
+        }
+        return *this;
+    }
+
+    auto peekHead() -> reference
+    {
+        if (empty())
+        {
+            throw ListOutOfRangeException("peekHead() called on an empty list");
+        }
+        return *fromHook(mSentinel.mNext);
+    }
+
+    auto peekHead() const -> const_reference
+    {
+        return const_cast<IntrusiveList*>(this)->peekHead();
+    }
+
+    auto peekTail() -> reference
+    {
+        if (empty())
+        {
+            throw ListOutOfRangeException("peekTail() called on an empty list");
+        }
+        return *fromHook(mSentinel.mPrev);
+    }
+
+    auto peekTail() const -> const_reference
+    {
+        return const_cast<IntrusiveList*>(this)->peekTail();
+    }
+
+    // Возвращают исключённый элемент или nullptr на пустом списке
+    auto popHead() noexcept -> pointer
+    {
+        return empty() ? nullptr : unlinkElement(mSentinel.mNext);
+    }
+
+    auto popTail() noexcept -> pointer
+    {
+        return empty() ? nullptr : unlinkElement(mSentinel.mPrev);
+    }
+
+    // Элемент, уже состоящий в каком-либо списке, сначала исключается из него
+    void pushHead(reference element) noexcept
+    {
+        link(mSentinel.mNext, element);
+    }
+
+    void pushTail(reference element) noexcept
+    {
+        link(&mSentinel, element);
+    }
+
+    // Псевдоним `pushHead` для совместимости с front_inserter
+    void push_front(reference element) noexcept
+    {
+        pushHead(element);
+    }
+
+    // Псевдоним `pushTail` для совместимости с back_inserter
+    void push_back(reference element) noexcept
+    {
+        pushTail(element);
+    }
+
+    auto insertBefore(const_iterator position, reference element) -> iterator
+    {
+        position.validateIterator();
+        link(position.mHook, element);
+        return iteratorTo(element);
+    }
+
+    auto insertAfter(const_iterator position, reference element) -> iterator
+    {
+        if (position == cend())
+        {
+            throw ListOutOfRangeException("Couldn't insert after the end of the list");
+        }
+        return insertBefore(++position, element);
+    }
+
+    // Псевдоним `insertBefore` для совместимости с inserter
+    auto insert(const_iterator position, reference element) -> iterator
+    {
+        return insertBefore(position, element);
+    }
+
+    // Возвращает итератор на следующий элемент
+    auto erase(const_iterator position) -> iterator
+    {
+        if (position == cend())
+        {
+            throw ListOutOfRangeException("Couldn't erase the end of the list");
+        }
+
+        auto next = std::next(position);
+        unlinkElement(position.mHook);
+        return iterator(next.mHook);
+    }
+
+    void erase(reference element) noexcept
+    {
+        (element.*Hook).unlink();
+    }
+
+    // Итератор на элемент по ссылке на него, за O(1)
+    auto iteratorTo(reference element) noexcept -> iterator
+    {
+        return iterator(&(element.*Hook));
+    }
+
+    auto iteratorTo(const_reference element) const noexcept -> const_iterator
+    {
+        return const_iterator(const_cast<ListHook*>(&(element.*Hook)));
+    }
+
+    auto contains(const_reference element) const noexcept -> bool
+    {
+        return (element.*Hook).mOwner == this;
+    }
+
+    auto operator+=(IntrusiveList&& that) -> IntrusiveList&
+    {
+        append(std::move(that));
+        return *this;
+    }
+
+    void append(IntrusiveList&& that)
+    {
+        if (this == &that)
+        {
+            throw MovedSelfAppendException("Trying to concatenate moved list with itself");
+        }
+        spliceAll(that);
+    }
+
+    void swap(IntrusiveList& other) noexcept
+    {
+        auto temp = IntrusiveList(std::move(other));
+        other.spliceAll(*this);
+        spliceAll(temp);
+    }
+
+    auto begin() noexcept -> iterator
+    {
+        return iterator(mSentinel.mNext);
+    }
+
+    auto begin() const noexcept -> const_iterator
+    {
+        return cbegin();
+    }
+
+    auto end() noexcept -> iterator
+    {
+        return iterator(&mSentinel);
+    }
+
+    auto end() const noexcept -> const_iterator
+    {
+        return cend();
+    }
+
+    auto cbegin() const noexcept -> const_iterator
+    {
+        return const_iterator(mSentinel.mNext);
+    }
+
+    auto cend() const noexcept -> const_iterator
+    {
+        return const_iterator(const_cast<ListHook*>(&mSentinel));
+    }
+
+    auto rbegin() noexcept -> reverse_iterator
+    {
+        return reverse_iterator(end());
+    }
+
+    auto rend() noexcept -> reverse_iterator
+    {
+        return reverse_iterator(begin());
+    }
+
+    auto crbegin() const noexcept -> const_reverse_iterator
+    {
+        return const_reverse_iterator(cend());
+    }
+
+    auto crend() const noexcept -> const_reverse_iterator
+    {
+        return const_reverse_iterator(cbegin());
+    }
+
+private:
+    // Смещение крючка внутри T, вычисляется на неинициализированном хранилище
+    static auto hookOffset() noexcept -> std::ptrdiff_t
+    {
+        alignas(T) static std::byte storage[sizeof(T)];
+        auto object = reinterpret_cast<T*>(storage);
+        return reinterpret_cast<std::byte*>(&(object->*Hook)) - storage;
+    }
+
+    static auto fromHook(ListHook* hook) noexcept -> pointer
+    {
+        return reinterpret_cast<pointer>(reinterpret_cast<std::byte*>(hook) - hookOffset());
+    }
+
+    void link(ListHook* position, reference element) noexcept
+    {
+        auto hook = &(element.*Hook);
+        if (hook == position)
+        {
+            return;
+        }
+        hook->unlink();
+        linkBefore(position, hook);
+    }
+
+    auto unlinkElement(ListHook* hook) noexcept -> pointer
+    {
+        hook->unlink();
+        return fromHook(hook);
+    }
+};
+
+template<typename T, ListHook T::*Hook>
+auto operator<<(std::ostream& os, const IntrusiveList<T, Hook>& ls) -> std::ostream&
+{
+    os << "[";
+    for (auto separator = ""; const auto& element : ls)
+    {
+        os << separator << element;
+        separator = ", ";
+    }
+    os << "]";
+    return os;
+}
+
+} // namespace mylist
@@ -1,19 +1,42 @@
 #pragma once
 
 #include "_iterators.hpp"
+#include "_memory.hpp"
 #include "_node.hpp"
+#include "_node_cache.hpp"
+#include "_node_pool.hpp"
+#include "_prefetch.hpp"
+#include "_reclaimer.hpp"
+#include "_status.hpp"
+#include <algorithm>
 #include <cstddef>
+#include <exception>
+#include <functional>
 #include <initializer_list>
 #include <iterator>
 #include <memory>
+#include <memory_resource>
+#include <new>
 #include <optional>
 #include <ostream>
 #include <ranges>
+#include <thread>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace mylist
 {
 
+// Аргумент конструкторов и append, включающий параллельное построение.
+// threads == 0 — по числу аппаратных потоков.
+struct Parallel
+{
+    unsigned threads = 0;
+};
+
+inline constexpr auto parallel = Parallel();
+
 class ListBase
 {
 public:
@@ -35,7 +58,7 @@ protected:
     size_type mLen{};
 };
 
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class List : public ListBase
 {
 public:
@@ -45,16 +68,27 @@ public:
     using reference = value_type&;
     using const_reference = const value_type&;
     using size_type = ListBase::size_type;
+    using allocator_type = Allocator;
 
     using iterator = Iterator<value_type>;
     using const_iterator = ConstIterator<value_type>;
     using reverse_iterator = std::reverse_iterator<iterator>;
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
-    ~List() = default;
+    // Вставка из args не бросает ничего, кроме std::bad_alloc: значение,
+    // узел из запаса и терминатор пустого списка строятся без исключений
+    template<typename... Args>
+    static constexpr bool nothrowInsertable = std::is_nothrow_constructible_v<value_type, Args...>
+                                           && std::is_nothrow_move_constructible_v<value_type>
+                                           && std::is_nothrow_move_assignable_v<value_type>
+                                           && std::is_nothrow_default_constructible_v<value_type>;
+
+    ~List();
 
     List() = default;
+    explicit List(const allocator_type& allocator) noexcept;
     List(std::initializer_list<value_type> list);
+    List(std::initializer_list<value_type> list, const allocator_type& allocator);
     List(const List& that);
     List(size_type count, value_type value = value_type());
     List(List&& that) noexcept;
@@ -68,6 +102,14 @@ public:
         requires std::convertible_to<typename std::iterator_traits<std::ranges::iterator_t<Rng>>::value_type,
                                      value_type>;
 
+    // Источник делится на участки, каждый поток собирает свою цепочку узлов,
+    // цепочки сшиваются за O(участков). Короткие источники копируются в одном потоке.
+    List(Parallel policy, const List& that);
+
+    template<std::random_access_iterator It>
+    List(Parallel policy, It begin, It end)
+        requires std::convertible_to<typename std::iterator_traits<It>::value_type, value_type>;
+
     auto operator=(const List& that) -> List&;
     auto operator=(List&& that) noexcept -> List&;
 
@@ -79,6 +121,20 @@ public:
     auto popHead() noexcept -> std::optional<value_type>;
     auto popTail() noexcept -> std::optional<value_type>;
 
+    // Извлекают до count элементов, отрезая их от списка целым участком
+    template<std::weakly_incrementable Out>
+    auto popHeadN(size_type count, Out out) -> Out
+        requires std::indirectly_writable<Out, value_type>;
+
+    template<std::weakly_incrementable Out>
+    auto popTailN(size_type count, Out out) -> Out
+        requires std::indirectly_writable<Out, value_type>;
+
+    // Переносит все элементы в конец контейнера, возвращает их количество
+    template<typename Container>
+    auto drainTo(Container& container) -> size_type
+        requires requires(Container& c, value_type&& v) { c.push_back(std::move(v)); };
+
     void pushHead(std::convertible_to<value_type> auto&& element);
     void pushTail(std::convertible_to<value_type> auto&& element);
 
@@ -114,6 +170,32 @@ public:
     auto emplace(const_iterator position, Args&&... args) -> iterator
         requires std::constructible_from<value_type, Args...>;
 
+    // Варианты без исключений: пустой список даёт nullptr, неверная позиция
+    // и нехватка памяти — Status. Вставка noexcept, если конструкторы T не
+    // бросают; иначе их исключения проходят насквозь. Как и у emplace*,
+    // tryEmplace* не запускают автоматическое сжатие: оно сделало бы
+    // возвращаемый итератор висячим. tryInsert* сжимают список, а неудачу
+    // сжатия пропускают: compact() тогда оставляет список прежним
+    auto tryPeekHead() noexcept -> pointer;
+    auto tryPeekHead() const noexcept -> const_pointer;
+    auto tryPeekTail() noexcept -> pointer;
+    auto tryPeekTail() const noexcept -> const_pointer;
+
+    auto tryInsertBefore(const_iterator position, std::convertible_to<value_type> auto&& value) noexcept(
+        nothrowInsertable<decltype(value)>) -> Status;
+    auto tryInsertAfter(const_iterator position, std::convertible_to<value_type> auto&& value) noexcept(
+        nothrowInsertable<decltype(value)>) -> Status;
+
+    template<typename... Args>
+    auto tryEmplaceBefore(const_iterator position, Args&&... args) noexcept(nothrowInsertable<Args...>)
+        -> Expected<iterator>
+        requires std::constructible_from<value_type, Args...>;
+
+    template<typename... Args>
+    auto tryEmplaceAfter(const_iterator position, Args&&... args) noexcept(nothrowInsertable<Args...>)
+        -> Expected<iterator>
+        requires std::constructible_from<value_type, Args...>;
+
     auto operator+=(const List& that) -> List&;
     auto operator+=(List&& that) -> List&;
     void append(const List& that);
@@ -127,9 +209,108 @@ public:
     void append(It begin, It end)
         requires std::convertible_to<typename std::iterator_traits<It>::value_type, value_type>;
 
+    void append(Parallel policy, const List& that);
+
+    template<std::random_access_iterator It>
+    void append(Parallel policy, It begin, It end)
+        requires std::convertible_to<typename std::iterator_traits<It>::value_type, value_type>;
+
     void clear() noexcept;
+
+    // Распределители не обмениваются: каждый узел сам помнит, чем его освобождать
     void swap(List& other) noexcept;
 
+    auto get_allocator() const noexcept -> allocator_type;
+
+    // Забывает все узлы за O(1), не разрушая их. Только для распределителей-арен
+    // (monotonic_buffer_resource и т.п.), память которых освобождается целиком;
+    // итераторы на забытые узлы нельзя использовать после освобождения арены.
+    void abandon()
+        requires(!std::is_same_v<Allocator, std::allocator<T>>);
+
+    // Удаляет элемент, возвращает итератор на следующий
+    auto erase(const_iterator position) -> iterator;
+
+    // Переносит узел it из other (может совпадать с *this) перед position за O(1).
+    // Итераторы на перенесённый элемент остаются верными и указывают в *this.
+    void splice(const_iterator position, List& other, const_iterator it);
+
+    // Алгоритмы ниже только перевязывают существующие узлы: O(n), без выделений.
+    // Итераторы на удалённые элементы становятся висячими, на остальные остаются верными.
+    template<typename Pred>
+    auto removeIf(Pred pred) -> size_type;
+
+    // Удаляет подряд идущие равные элементы, оставляя первый из них
+    template<typename BinaryPred = std::equal_to<>>
+    auto unique(BinaryPred pred = {}) -> size_type;
+
+    void reverse() noexcept;
+
+    // Устойчивое разбиение: элементы, для которых pred истинен, идут первыми.
+    // Возвращает итератор на первый элемент второй группы.
+    template<typename Pred>
+    auto partition(Pred pred) -> iterator;
+
+    // Делает position новой головой списка за O(1), возвращает итератор на прежнюю голову
+    auto rotate(const_iterator position) -> iterator;
+
+    // Сливает упорядоченный по comp other в упорядоченный *this за O(n + m).
+    // При равных элементах первыми идут элементы *this; other становится пустым.
+    template<typename Compare = std::less<>>
+    void merge(List& other, Compare comp = {});
+
+    // Запас узлов: после reserve(n) в списке помещается n элементов без
+    // выделений памяти, а узлы, снятые pop*, pop*N, drainTo, erase, removeIf,
+    // unique и clear(), возвращаются в запас, пока ёмкость не достигнет
+    // зарезервированной. Итераторы на снятые элементы становятся висячими
+    // и после переиспользования узла.
+    void reserve(size_type count);
+    auto capacity() const noexcept -> size_type;
+
+    // Освобождает запас, ёмкость становится равной размеру
+    void shrink_to_fit() noexcept;
+
+    // Память списка вместе с терминатором и запасом, см. MemoryUsage. За O(1),
+    // кроме списков со стандартным распределителем после compact(): их узлы
+    // сверяются с пулом за O(n). Узлы из пулов других списков, перенесённые
+    // сюда splice/append, считаются как узлы из кэша блоков. Снятый узел, на
+    // который остались итераторы, держит свой блок, но в учёт уже не входит
+    auto memory_usage() const -> MemoryUsage;
+
+    // Пересоздаёт узлы в одном непрерывном куске памяти в порядке обхода.
+    // Значения сохраняются, все итераторы и ссылки становятся висячими.
+    // Если выделение бросает исключение, список остаётся прежним.
+    void compact();
+
+    // Доля узлов, вставленных не в порядке обхода, с последнего compact()
+    auto fragmentation() const noexcept -> double;
+
+    // При threshold > 0 вставки в середину, в голову и append(List&&)
+    // сами вызывают compact(), когда fragmentation() достигает порога
+    void setCompactionThreshold(double threshold) noexcept;
+
+    // Обход по сырым указателям с подгрузкой узлов на prefetchDistance() шагов
+    // вперёд. Используется копированием, append(const List&) и operator<<.
+    // fn может дописывать в конец списка: обходятся только элементы, бывшие
+    // в нём при вызове. Удалять и переставлять элементы fn не должна.
+    template<typename Fn>
+    void forEach(Fn fn);
+
+    template<typename Fn>
+    void forEach(Fn fn) const;
+
+    // 0 отключает упреждающую подгрузку
+    void setPrefetchDistance(size_type distance) noexcept;
+    auto prefetchDistance() const noexcept -> size_type;
+
+    // Узлы, снятые popHead/popTail, и цепочки clear() и деструктора
+    // разрушает поток reclaimer; nullptr — освобождение на месте.
+    // reclaimer должен пережить список и все его копии, а распределитель —
+    // допускать освобождение с другого потока. Итераторы на снятые узлы
+    // становятся висячими, только когда узлы действительно освобождены
+    void setReclaimer(Reclaimer* reclaimer) noexcept;
+    auto reclaimer() const noexcept -> Reclaimer*;
+
     auto begin() noexcept -> iterator
     {
         return iterator(mHead);
@@ -182,9 +363,57 @@ public:
 
 private:
     using ValueNode = Node<value_type>;
+    [[no_unique_address]] allocator_type mAllocator{};
     std::shared_ptr<ValueNode> mHead{};
     std::weak_ptr<ValueNode> mTail{};
     std::weak_ptr<ValueNode> mTerminator{}; // фиктивная граница
+    size_type mLayoutChanges{};
+    double mCompactionThreshold{};
+    size_type mPrefetchDistance{defaultPrefetchDistance};
+    Reclaimer* mReclaimer{};
+    std::shared_ptr<ValueNode> mSpare{}; // запасные узлы, связанные через next
+    size_type mSpareCount{};
+    size_type mReserved{};
+    std::weak_ptr<NodePool> mPool{}; // пул последнего compact() со стандартным распределителем
+
+    static constexpr size_type defaultPrefetchDistance = 4;
+
+    static constexpr size_type minCompactionSize = 64;
+
+    // compact() переносит значения перемещением без исключений, которое
+    // откатывается при неудаче, или копированием, которое их не трогает
+    static constexpr bool strongCompaction =
+        (std::is_nothrow_move_constructible_v<value_type> && std::is_nothrow_move_assignable_v<value_type>)
+        || (std::is_copy_constructible_v<value_type> && !std::is_nothrow_move_constructible_v<value_type>);
+
+    void maybeCompact();
+
+    // Освобождает цепочку на месте или через mReclaimer
+    void release(std::shared_ptr<ValueNode>&& chain, bool wholeChain = false) noexcept;
+
+    // Узел и блок управления берутся из mAllocator одним выделением;
+    // со стандартным распределителем — из потокового кэша блоков
+    template<typename... Args>
+    auto makeNode(Args&&... args) -> std::shared_ptr<ValueNode>;
+
+    // Сколько байт makeNode берёт у распределителя на узел с блоком управления
+    auto nodeBlockSize() const -> size_type;
+
+    // Узел из запаса, если он есть, иначе makeNode. Только для вызовов
+    // из потока-владельца: запас не синхронизирован
+    template<typename... Args>
+    auto takeNode(Args&&... args) -> std::shared_ptr<ValueNode>;
+
+    // Кладёт узел в запас, если ёмкость меньше зарезервированной
+    auto recycle(std::shared_ptr<ValueNode>& node) noexcept -> bool;
+
+    // Снятые узел или цепочку кладёт в запас, пока он не заполнен,
+    // остальное отдаёт release
+    void discard(std::shared_ptr<ValueNode>&& node) noexcept;
+    void discardChain(std::shared_ptr<ValueNode>&& chain) noexcept;
+
+    // Забирает запас и резерв у from, свой запас освобождает
+    void takeReserve(List& from) noexcept;
 
     auto popTerminator() -> std::shared_ptr<ValueNode>;
     void addTerminator(std::shared_ptr<ValueNode>&& sentinel);
@@ -192,18 +421,81 @@ private:
     void pushTail(std::shared_ptr<ValueNode>&& node);
     void insertInEmpty(std::shared_ptr<ValueNode>&& node);
     void insertBefore(const_iterator position, std::shared_ptr<ValueNode>&& node);
+
+    // Общая часть try*-вставок: вставляет перед position или возвращает её
+    // ошибку. Список не сжимает, поэтому position остаётся верной
+    template<typename... Args>
+    auto tryInsertNode(const Expected<const_iterator>& position, Args&&... args) noexcept(
+        nothrowInsertable<Args...>) -> Status;
+
+    // maybeCompact() для try*-вставок: ошибка сжатия не выходит наружу,
+    // а типы, для которых compact() не откатывается, не сжимаются
+    void tryCompact() noexcept;
+
+    // Итератор на узел после position, если он есть
+    static auto nextOf(const const_iterator& position) noexcept -> Expected<const_iterator>;
+
+    // Цепочка узлов без терминатора, собираемая перед возвратом в список
+    struct Chain
+    {
+        std::shared_ptr<ValueNode> head;
+        std::shared_ptr<ValueNode>* tail = nullptr; // владеющий указатель на последний узел
+        size_type size{};
+
+        Chain() = default;
+        Chain(const Chain&) = delete;
+        auto operator=(const Chain&) -> Chain& = delete;
+
+        ~Chain()
+        {
+            while (head)
+            {
+                head = std::move(head->next);
+            }
+        }
+
+        void pushTail(std::shared_ptr<ValueNode>&& node) noexcept;
+        void append(Chain&& other) noexcept;
+    };
+
+    auto unlink(ValueNode* prevNode, ValueNode* node) noexcept -> std::shared_ptr<ValueNode>;
+    void adopt(Chain&& chain, std::shared_ptr<ValueNode>&& sentinel) noexcept;
+    void appendChain(Chain&& chain);
+
+    // Меньшие участки не стоят запуска потока
+    static constexpr size_type minParallelSegment = 4096;
+
+    auto parallelSegments(Parallel policy, size_type count) const noexcept -> size_type;
+
+    // fill(chain, segment) собирает цепочку участка segment
+    template<typename Fill>
+    void appendSegments(size_type segments, Fill fill);
+
+    template<typename Fn>
+    static void walk(ValueNode* node, size_type count, size_type distance, Fn& fn);
+
+    template<typename Out>
+    auto drainChain(std::shared_ptr<ValueNode>&& chain, size_type count, Out out) -> Out;
 };
 
-template<typename T>
+template<typename T, typename Allocator>
+List<T, Allocator>::~List()
+{
+    mReserved = 0;
+    clear();
+    release(std::move(mSpare), true);
+}
+
+template<typename T, typename Allocator>
 template<std::input_iterator It>
-List<T>::List(It begin, It end)
+List<T, Allocator>::List(It begin, It end)
     requires std::convertible_to<typename std::iterator_traits<It>::value_type, value_type>
 {
     std::ranges::for_each(begin, end, [this](const value_type& element) { pushTail(element); });
 }
 
-template<typename T>
-List<T>::List(size_type count, value_type value)
+template<typename T, typename Allocator>
+List<T, Allocator>::List(size_type count, value_type value)
 {
     for (size_type i = 0; i < count; ++i)
     {
@@ -211,131 +503,168 @@ List<T>::List(size_type count, value_type value)
     }
 }
 
-template<typename T>
-List<T>::List(List&& that) noexcept
-    : mHead(std::move(that.mHead)), mTail(std::move(that.mTail)), mTerminator(std::move(that.mTerminator))
+template<typename T, typename Allocator>
+List<T, Allocator>::List(const allocator_type& allocator) noexcept : mAllocator(allocator)
+{
+}
+
+template<typename T, typename Allocator>
+List<T, Allocator>::List(List&& that) noexcept
+    : mAllocator(that.mAllocator), mHead(std::move(that.mHead)), mTail(std::move(that.mTail)),
+      mTerminator(std::move(that.mTerminator)), mLayoutChanges(std::exchange(that.mLayoutChanges, 0)),
+      mCompactionThreshold(that.mCompactionThreshold), mPrefetchDistance(that.mPrefetchDistance),
+      mReclaimer(that.mReclaimer), mSpare(std::move(that.mSpare)), mSpareCount(std::exchange(that.mSpareCount, 0)),
+      mReserved(std::exchange(that.mReserved, 0)), mPool(std::move(that.mPool))
 {
     mLen = std::exchange(that.mLen, 0);
 }
 
-template<typename T>
-List<T>::List(const List& that) : List(that.begin(), that.end())
+template<typename T, typename Allocator>
+List<T, Allocator>::List(const List& that)
+    : mAllocator(std::allocator_traits<Allocator>::select_on_container_copy_construction(that.mAllocator)),
+      mCompactionThreshold(that.mCompactionThreshold), mPrefetchDistance(that.mPrefetchDistance),
+      mReclaimer(that.mReclaimer)
 {
+    append(that);
 }
 
-template<typename T>
-List<T>::List(std::initializer_list<value_type> list) : List(list.begin(), list.end())
+template<typename T, typename Allocator>
+List<T, Allocator>::List(std::initializer_list<value_type> list) : List(list.begin(), list.end())
 {
 }
 
-template<typename T>
+template<typename T, typename Allocator>
+List<T, Allocator>::List(std::initializer_list<value_type> list, const allocator_type& allocator)
+    : mAllocator(allocator)
+{
+    append(list.begin(), list.end());
+}
+
+template<typename T, typename Allocator>
 template<std::ranges::input_range Rng>
-List<T>::List(const Rng& range)
+List<T, Allocator>::List(const Rng& range)
     requires std::convertible_to<typename std::iterator_traits<std::ranges::iterator_t<Rng>>::value_type, value_type>
     : List(std::ranges::begin(range), std::ranges::end(range))
 {
 }
 
-template<typename T>
-auto List<T>::operator=(const List& that) -> List&
+template<typename T, typename Allocator>
+auto List<T, Allocator>::operator=(const List& that) -> List&
 {
     if (this != &that)
     {
-        List(that).swap(*this);
+        auto copy = List(mAllocator);
+        copy.mCompactionThreshold = that.mCompactionThreshold;
+        copy.mPrefetchDistance = that.mPrefetchDistance;
+        copy.mReclaimer = that.mReclaimer;
+        copy.takeReserve(*this);
+        copy.append(that);
+        swap(copy);
     }
     return *this;
 }
 
-template<typename T>
-auto List<T>::operator=(List&& that) noexcept -> List&
+template<typename T, typename Allocator>
+auto List<T, Allocator>::operator=(List&& that) noexcept -> List&
 {
     if (this != &that)
     {
+        clear();
         mHead = std::move(that.mHead);
         mTail = std::move(that.mTail);
         mTerminator = std::move(that.mTerminator);
         mLen = std::exchange(that.mLen, 0);
+        mLayoutChanges = std::exchange(that.mLayoutChanges, 0);
+        mCompactionThreshold = that.mCompactionThreshold;
+        mPrefetchDistance = that.mPrefetchDistance;
+        mReclaimer = that.mReclaimer;
+        mPool = std::move(that.mPool);
+        takeReserve(that);
     }
     return *this;
 }
 
-template<typename T>
-void List<T>::pushHead(std::convertible_to<value_type> auto&& element)
+template<typename T, typename Allocator>
+void List<T, Allocator>::pushHead(std::convertible_to<value_type> auto&& element)
 {
-    pushHead(ValueNode::create(std::forward<decltype(element)>(element)));
+    pushHead(takeNode(std::forward<decltype(element)>(element)));
+    maybeCompact();
 }
 
-template<typename T>
-void List<T>::push_front(std::convertible_to<value_type> auto&& element)
+template<typename T, typename Allocator>
+void List<T, Allocator>::push_front(std::convertible_to<value_type> auto&& element)
 {
     pushHead(std::forward<decltype(element)>(element));
 }
 
-template<typename T>
-void List<T>::pushTail(std::convertible_to<value_type> auto&& element)
+template<typename T, typename Allocator>
+void List<T, Allocator>::pushTail(std::convertible_to<value_type> auto&& element)
 {
-    pushTail(ValueNode::create(std::forward<decltype(element)>(element)));
+    pushTail(takeNode(std::forward<decltype(element)>(element)));
 }
 
-template<typename T>
-void List<T>::push_back(std::convertible_to<value_type> auto&& element)
+template<typename T, typename Allocator>
+void List<T, Allocator>::push_back(std::convertible_to<value_type> auto&& element)
 {
     pushTail(std::forward<decltype(element)>(element));
 }
 
-template<typename T>
+template<typename T, typename Allocator>
 template<typename... Args>
-auto List<T>::emplaceHead(Args&&... args) -> reference
+auto List<T, Allocator>::emplaceHead(Args&&... args) -> reference
     requires std::constructible_from<value_type, Args...>
 {
-    pushHead(ValueNode::create(value_type(std::forward<Args>(args)...)));
+    pushHead(takeNode(value_type(std::forward<Args>(args)...)));
+    maybeCompact();
     return mHead->value;
 }
 
-template<typename T>
+template<typename T, typename Allocator>
 template<typename... Args>
-auto List<T>::emplaceTail(Args&&... args) -> reference
+auto List<T, Allocator>::emplaceTail(Args&&... args) -> reference
     requires std::constructible_from<value_type, Args...>
 {
-    pushTail(ValueNode::create(value_type(std::forward<Args>(args)...)));
+    pushTail(takeNode(value_type(std::forward<Args>(args)...)));
     return mTail.lock()->value;
 }
 
-template<typename T>
-void List<T>::insertAfter(const_iterator position, std::convertible_to<value_type> auto&& value)
+template<typename T, typename Allocator>
+void List<T, Allocator>::insertAfter(const_iterator position, std::convertible_to<value_type> auto&& value)
 {
     if (position == cend())
     {
         throw ListOutOfRangeException("Couldn't insert after the end of the list");
     }
 
-    insertBefore(++position, ValueNode::create(std::forward<decltype(value)>(value)));
+    insertBefore(++position, takeNode(std::forward<decltype(value)>(value)));
+    maybeCompact();
 }
 
-template<typename T>
-void List<T>::insertBefore(const_iterator position, std::convertible_to<value_type> auto&& value)
+template<typename T, typename Allocator>
+void List<T, Allocator>::insertBefore(const_iterator position, std::convertible_to<value_type> auto&& value)
 {
-    insertBefore(position, ValueNode::create(std::forward<decltype(value)>(value)));
+    insertBefore(position, takeNode(std::forward<decltype(value)>(value)));
+    maybeCompact();
 }
 
-template<typename T>
-void List<T>::insert(const_iterator position, std::convertible_to<value_type> auto&& value)
+template<typename T, typename Allocator>
+void List<T, Allocator>::insert(const_iterator position, std::convertible_to<value_type> auto&& value)
 {
     insertBefore(position, std::forward<decltype(value)>(value));
 }
 
-template<typename T>
+template<typename T, typename Allocator>
 template<typename... Args>
-auto List<T>::emplaceBefore(const_iterator position, Args&&... args) -> iterator
+auto List<T, Allocator>::emplaceBefore(const_iterator position, Args&&... args) -> iterator
     requires std::constructible_from<value_type, Args...>
 {
-    insertBefore(position, ValueNode::create(value_type(std::forward<Args>(args)...)));
+    insertBefore(position, takeNode(value_type(std::forward<Args>(args)...)));
     return (--position).currentNode;
 }
 
-template<typename T>
+template<typename T, typename Allocator>
 template<typename... Args>
-auto List<T>::emplaceAfter(const_iterator position, Args&&... args) -> iterator
+auto List<T, Allocator>::emplaceAfter(const_iterator position, Args&&... args) -> iterator
     requires std::constructible_from<value_type, Args...>
 {
     if (position == cend())
@@ -346,41 +675,159 @@ auto List<T>::emplaceAfter(const_iterator position, Args&&... args) -> iterator
     return emplaceBefore(++position, std::forward<Args>(args)...);
 }
 
-template<typename T>
+template<typename T, typename Allocator>
 template<typename... Args>
-auto List<T>::emplace(const_iterator position, Args&&... args) -> iterator
+auto List<T, Allocator>::emplace(const_iterator position, Args&&... args) -> iterator
     requires std::constructible_from<value_type, Args...>
 {
     return emplaceBefore(position, std::forward<Args>(args)...);
 }
 
-template<typename T>
-auto List<T>::operator+=(const List& that) -> List&
+template<typename T, typename Allocator>
+auto List<T, Allocator>::tryInsertBefore(const_iterator position,
+                                         std::convertible_to<value_type> auto&& value) noexcept(
+    nothrowInsertable<decltype(value)>) -> Status
+{
+    auto status = tryInsertNode(position, std::forward<decltype(value)>(value));
+    tryCompact();
+    return status;
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::tryInsertAfter(const_iterator position, std::convertible_to<value_type> auto&& value) noexcept(
+    nothrowInsertable<decltype(value)>) -> Status
+{
+    auto status = tryInsertNode(nextOf(position), std::forward<decltype(value)>(value));
+    tryCompact();
+    return status;
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+auto List<T, Allocator>::tryEmplaceBefore(const_iterator position, Args&&... args) noexcept(nothrowInsertable<Args...>)
+    -> Expected<iterator>
+    requires std::constructible_from<value_type, Args...>
+{
+    if (auto status = tryInsertNode(position, std::forward<Args>(args)...); status != Status::ok)
+    {
+        return status;
+    }
+    position.tryPrev();
+    return iterator(position.currentNode);
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+auto List<T, Allocator>::tryEmplaceAfter(const_iterator position, Args&&... args) noexcept(nothrowInsertable<Args...>)
+    -> Expected<iterator>
+    requires std::constructible_from<value_type, Args...>
+{
+    auto next = nextOf(position);
+    if (auto status = tryInsertNode(next, std::forward<Args>(args)...); status != Status::ok)
+    {
+        return status;
+    }
+    next->tryPrev();
+    return iterator(next->currentNode);
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+auto List<T, Allocator>::tryInsertNode(const Expected<const_iterator>& position, Args&&... args) noexcept(
+    nothrowInsertable<Args...>) -> Status
+{
+    if (!position)
+    {
+        return position.status();
+    }
+    if (position->dangling())
+    {
+        return Status::danglingIterator;
+    }
+
+    try
+    {
+        insertBefore(*position, takeNode(value_type(std::forward<Args>(args)...)));
+    }
+    catch (const std::bad_alloc&)
+    {
+        return Status::outOfMemory;
+    }
+    return Status::ok;
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::tryCompact() noexcept
+{
+    // Неудачное сжатие оставляет список прежним, а оно только ускоряет обход,
+    // поэтому его ошибка не отменяет вставку. Без такой гарантии не сжимаем
+    if constexpr (strongCompaction)
+    {
+        try
+        {
+            maybeCompact();
+        }
+        catch (...)
+        {
+        }
+    }
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::nextOf(const const_iterator& position) noexcept -> Expected<const_iterator>
+{
+    // Узел блокируется один раз; следующего узла нет только у терминатора
+    auto node = position.lockNode();
+    if (!node)
+    {
+        return Status::danglingIterator;
+    }
+    if (!node->next)
+    {
+        return Status::outOfRange;
+    }
+    return const_iterator(node->next);
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::operator+=(const List& that) -> List&
 {
     this->append(that);
     return *this;
 }
 
-template<typename T>
-auto List<T>::operator+=(List&& that) -> List&
+template<typename T, typename Allocator>
+auto List<T, Allocator>::operator+=(List&& that) -> List&
 {
     this->append(std::move(that));
     return *this;
 }
 
-template<typename T>
-void List<T>::append(List&& that)
+template<typename T, typename Allocator>
+void List<T, Allocator>::append(List&& that)
 {
     if (this == &that)
     {
         throw MovedSelfAppendException("Trying to concatenate moved list with itself");
     }
 
+    if (that.empty())
+    {
+        return;
+    }
+
     if (empty())
     {
-        *this = std::move(that);
+        // Переезжает только цепочка that: запас, настройки и mReclaimer
+        // остаются свои, как и при добавлении в непустой список
+        auto sent = std::exchange(mHead, std::move(that.mHead));
+        mTail = std::move(that.mTail);
+        mTerminator = std::move(that.mTerminator);
+        mLayoutChanges = std::exchange(that.mLayoutChanges, 0);
+        mLen = std::exchange(that.mLen, 0);
+        discard(std::move(sent));
     }
-    else if (!that.empty())
+    else
     {
         popTerminator();
         that.mHead->prev = mTail;
@@ -388,155 +835,1071 @@ void List<T>::append(List&& that)
         mTail = std::move(that.mTail);
         mTerminator = std::move(that.mTerminator);
 
+        mLayoutChanges += that.mLen + std::exchange(that.mLayoutChanges, 0);
         mLen += that.mLen;
         that.mLen = 0;
+        maybeCompact();
     }
 }
 
-template<typename T>
-void List<T>::append(const List& that)
+template<typename T, typename Allocator>
+void List<T, Allocator>::append(const List& that)
 {
-    std::ranges::for_each(that, [this](const value_type& element) { pushTail(element); });
+    that.forEach([this](const value_type& element) { pushTail(element); });
 }
 
-template<typename T>
-template<std::ranges::input_range Rng>
-void List<T>::append(const Rng& range)
-    requires std::convertible_to<typename Rng::value_type, value_type>
+template<typename T, typename Allocator>
+List<T, Allocator>::List(Parallel policy, const List& that)
+    : mAllocator(std::allocator_traits<Allocator>::select_on_container_copy_construction(that.mAllocator)),
+      mCompactionThreshold(that.mCompactionThreshold), mPrefetchDistance(that.mPrefetchDistance),
+      mReclaimer(that.mReclaimer)
 {
-    append(std::ranges::begin(range), std::ranges::end(range));
+    append(policy, that);
 }
 
-template<typename T>
-template<std::input_iterator It>
-void List<T>::append(It begin, It end)
+template<typename T, typename Allocator>
+template<std::random_access_iterator It>
+List<T, Allocator>::List(Parallel policy, It begin, It end)
     requires std::convertible_to<typename std::iterator_traits<It>::value_type, value_type>
 {
-    std::ranges::for_each(begin, end, [this](const value_type& element) { pushTail(element); });
+    append(policy, begin, end);
 }
 
-template<typename T>
-void List<T>::clear() noexcept
+template<typename T, typename Allocator>
+void List<T, Allocator>::append(Parallel policy, const List& that)
 {
-    mHead.reset();
-    mTail.reset();
-    mTerminator.reset();
-    mLen = 0;
-}
+    auto count = that.mLen;
+    auto segments = parallelSegments(policy, count);
+    if (segments < 2)
+    {
+        append(that);
+        return;
+    }
 
-template<typename T>
-void List<T>::swap(List& other) noexcept
-{
-    std::swap(mHead, other.mHead);
-    std::swap(mTail, other.mTail);
-    std::swap(mTerminator, other.mTerminator);
-    std::swap(mLen, other.mLen);
+    // Начала участков находятся одним проходом по исходному списку
+    auto starts = std::vector<const ValueNode*>();
+    starts.reserve(segments);
+    auto node = that.mHead.get();
+    for (size_type i = 0; i < count; ++i, node = node->next.get())
+    {
+        if (i % (count / segments) == 0 && starts.size() < segments)
+        {
+            starts.push_back(node);
+        }
+    }
+
+    appendSegments(segments, [&](Chain& chain, size_type segment) {
+        auto length = segment + 1 < segments ? count / segments : count - segment * (count / segments);
+        auto source = starts[segment];
+        for (size_type i = 0; i < length; ++i, source = source->next.get())
+        {
+            chain.pushTail(makeNode(source->value));
+        }
+    });
 }
 
-template<typename T>
-auto List<T>::peekHead() -> reference
+template<typename T, typename Allocator>
+template<std::random_access_iterator It>
+void List<T, Allocator>::append(Parallel policy, It begin, It end)
+    requires std::convertible_to<typename std::iterator_traits<It>::value_type, value_type>
 {
-    if (empty())
+    auto count = static_cast<size_type>(std::distance(begin, end));
+    auto segments = parallelSegments(policy, count);
+    if (segments < 2)
     {
-        throw ListOutOfRangeException("peekHead() called on an empty list");
+        append(begin, end);
+        return;
     }
 
-    return mHead->value;
+    appendSegments(segments, [&](Chain& chain, size_type segment) {
+        auto first = begin + static_cast<std::ptrdiff_t>(segment * (count / segments));
+        auto last = segment + 1 < segments ? first + static_cast<std::ptrdiff_t>(count / segments) : end;
+        for (; first != last; ++first)
+        {
+            chain.pushTail(makeNode(value_type(*first)));
+        }
+    });
 }
 
-template<typename T>
-auto List<T>::peekHead() const -> const_reference
+// Нестандартные распределители (например, арены pmr) обычно не потокобезопасны,
+// поэтому параллельно строятся только списки со стандартным
+template<typename T, typename Allocator>
+auto List<T, Allocator>::parallelSegments(Parallel policy, size_type count) const noexcept -> size_type
 {
-    if (empty())
+    if constexpr (!std::is_same_v<Allocator, std::allocator<T>>)
     {
-        throw ListOutOfRangeException("peekHead() called on an empty list");
+        return 1;
     }
 
-    return mHead->value;
+    auto threads = policy.threads > 0 ? policy.threads : std::max(std::thread::hardware_concurrency(), 1u);
+    return std::min<size_type>(threads, count / minParallelSegment);
 }
 
-template<typename T>
-auto List<T>::peekTail() -> reference
+template<typename T, typename Allocator>
+template<typename Fill>
+void List<T, Allocator>::appendSegments(size_type segments, Fill fill)
 {
-    if (empty())
+    // Вектор не перевыделяется: Chain хранит указатель на собственное поле
+    auto chains = std::vector<Chain>(segments);
+    auto errors = std::vector<std::exception_ptr>(segments);
     {
-        throw ListOutOfRangeException("peekTail() called on an empty list");
+        auto workers = std::vector<std::jthread>();
+        workers.reserve(segments - 1);
+        auto run = [&](size_type segment) {
+            try
+            {
+                fill(chains[segment], segment);
+            }
+            catch (...)
+            {
+                errors[segment] = std::current_exception();
+            }
+        };
+        for (size_type segment = 1; segment < segments; ++segment)
+        {
+            workers.emplace_back(run, segment);
+        }
+        run(0);
     }
 
-    return mTail.lock()->value;
+    for (auto& error : errors)
+    {
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    auto result = Chain();
+    for (auto& chain : chains)
+    {
+        result.append(std::move(chain));
+    }
+    appendChain(std::move(result));
 }
 
-template<typename T>
-auto List<T>::peekTail() const -> const_reference
+template<typename T, typename Allocator>
+void List<T, Allocator>::appendChain(Chain&& chain)
 {
+    if (!chain.head)
+    {
+        return;
+    }
+
     if (empty())
     {
-        throw ListOutOfRangeException("peekTail() called on an empty list");
+        adopt(std::move(chain), makeNode());
+        return;
     }
 
-    return mTail.lock()->value;
+    auto sent = popTerminator();
+    auto oldTail = mTail.lock();
+    chain.head->prev = oldTail;
+    mTail = *chain.tail;
+    oldTail->next = std::move(chain.head);
+    chain.tail = nullptr;
+    mLen += std::exchange(chain.size, 0);
+    addTerminator(std::move(sent));
 }
 
-template<typename T>
-void List<T>::insertInEmpty(std::shared_ptr<ValueNode>&& node)
+template<typename T, typename Allocator>
+template<std::ranges::input_range Rng>
+void List<T, Allocator>::append(const Rng& range)
+    requires std::convertible_to<typename Rng::value_type, value_type>
 {
-    mHead = std::move(node);
-    mHead->next = ValueNode::create();
-    mHead->next->prev = mHead;
-    mTerminator = mHead->next;
-    mTail = mHead;
+    append(std::ranges::begin(range), std::ranges::end(range));
 }
 
-template<typename T>
-auto List<T>::popTerminator() -> std::shared_ptr<ValueNode>
+template<typename T, typename Allocator>
+template<std::input_iterator It>
+void List<T, Allocator>::append(It begin, It end)
+    requires std::convertible_to<typename std::iterator_traits<It>::value_type, value_type>
 {
-    return std::move(mTail.lock()->next);
+    std::ranges::for_each(begin, end, [this](const value_type& element) { pushTail(element); });
 }
 
-template<typename T>
-void List<T>::addTerminator(std::shared_ptr<ValueNode>&& sentinel)
+template<typename T, typename Allocator>
+void List<T, Allocator>::clear() noexcept
 {
-    sentinel->prev = mTail;
-    this->mTerminator = sentinel;
-    mTail.lock()->next = std::move(sentinel);
+    mTail.reset();
+    mTerminator.reset();
+    mLen = 0;
+    mLayoutChanges = 0;
+
+    discardChain(std::move(mHead));
 }
 
-template<typename T>
-void List<T>::pushHead(std::shared_ptr<ValueNode>&& node)
+template<typename T, typename Allocator>
+auto List<T, Allocator>::get_allocator() const noexcept -> allocator_type
 {
-    if (empty())
+    return mAllocator;
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::abandon()
+    requires(!std::is_same_v<Allocator, std::allocator<T>>)
+{
+    if (!mHead)
     {
-        insertInEmpty(std::move(node));
+        return;
     }
-    else
+
+    // Владеющий указатель на голову переезжает в память арены и никогда не
+    // разрушается, поэтому счётчики узлов не обнуляются и обхода цепочки нет
+    using HolderAllocator =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<std::shared_ptr<ValueNode>>;
+    auto holderAllocator = HolderAllocator(mAllocator);
+    auto holder = std::allocator_traits<HolderAllocator>::allocate(holderAllocator, 1);
+    std::construct_at(holder, std::move(mHead));
+
+    mTail.reset();
+    mTerminator.reset();
+    mLen = 0;
+    mLayoutChanges = 0;
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::swap(List& other) noexcept
+{
+    std::swap(mHead, other.mHead);
+    std::swap(mTail, other.mTail);
+    std::swap(mTerminator, other.mTerminator);
+    std::swap(mLen, other.mLen);
+    std::swap(mLayoutChanges, other.mLayoutChanges);
+    std::swap(mCompactionThreshold, other.mCompactionThreshold);
+    std::swap(mPrefetchDistance, other.mPrefetchDistance);
+    std::swap(mReclaimer, other.mReclaimer);
+    std::swap(mSpare, other.mSpare);
+    std::swap(mSpareCount, other.mSpareCount);
+    std::swap(mReserved, other.mReserved);
+    std::swap(mPool, other.mPool);
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::erase(const_iterator position) -> iterator
+{
+    auto node = position.validateIterator();
+    if (!node->next)
     {
-        mHead->prev = node;
-        node->next = std::move(mHead);
-        mHead = std::move(node);
+        throw ListOutOfRangeException("Couldn't erase the end of the list");
     }
-    ++mLen;
+
+    auto next = iterator(node->next);
+    discard(unlink(node->prev.lock().get(), node.get()));
+    return next;
 }
 
-template<typename T>
-void List<T>::pushTail(std::shared_ptr<ValueNode>&& node)
+template<typename T, typename Allocator>
+void List<T, Allocator>::splice(const_iterator position, List& other, const_iterator it)
 {
+    auto node = it.validateIterator();
+    if (!node->next)
+    {
+        throw ListOutOfRangeException("Couldn't splice the end of the list");
+    }
+
     if (empty())
     {
-        insertInEmpty(std::move(node));
+        other.unlink(node->prev.lock().get(), node.get());
+        pushTail(std::move(node));
+        return;
     }
-    else
+
+    auto target = position.validateIterator();
+    if (this == &other && (target == node || target == node->next))
     {
-        auto sent = popTerminator();
-        node->prev = mTail;
-        mTail.lock()->next = std::move(node);
-        mTail = mTail.lock()->next;
-        addTerminator(std::move(sent));
+        return;
     }
-    ++mLen;
+
+    node = other.unlink(node->prev.lock().get(), node.get());
+    insertBefore(position, std::move(node));
 }
 
-template<typename T>
-auto List<T>::popHead() noexcept -> std::optional<value_type>
+template<typename T, typename Allocator>
+template<typename Pred>
+auto List<T, Allocator>::removeIf(Pred pred) -> size_type
+{
+    // Снятые узлы собираются в цепочку и уходят в запас и mReclaimer разом
+    auto removed = size_type{};
+    auto removedChain = std::shared_ptr<ValueNode>();
+    auto prevNode = static_cast<ValueNode*>(nullptr);
+    auto node = mHead.get();
+    try
+    {
+        for (auto count = mLen; count > 0; --count)
+        {
+            auto next = node->next.get();
+            if (std::invoke(pred, std::as_const(node->value)))
+            {
+                auto removedNode = unlink(prevNode, node);
+                removedNode->next = std::move(removedChain);
+                removedChain = std::move(removedNode);
+                ++removed;
+            }
+            else
+            {
+                prevNode = node;
+            }
+            node = next;
+        }
+    }
+    catch (...)
+    {
+        discardChain(std::move(removedChain));
+        throw;
+    }
+    discardChain(std::move(removedChain));
+    return removed;
+}
+
+template<typename T, typename Allocator>
+template<typename BinaryPred>
+auto List<T, Allocator>::unique(BinaryPred pred) -> size_type
+{
+    if (mLen < 2)
+    {
+        return 0;
+    }
+
+    // Снятые узлы освобождаются разом, как в removeIf
+    auto removed = size_type{};
+    auto removedChain = std::shared_ptr<ValueNode>();
+    auto prevNode = mHead.get();
+    auto node = prevNode->next.get();
+    try
+    {
+        for (auto count = mLen - 1; count > 0; --count)
+        {
+            auto next = node->next.get();
+            if (std::invoke(pred, std::as_const(prevNode->value), std::as_const(node->value)))
+            {
+                auto removedNode = unlink(prevNode, node);
+                removedNode->next = std::move(removedChain);
+                removedChain = std::move(removedNode);
+                ++removed;
+            }
+            else
+            {
+                prevNode = node;
+            }
+            node = next;
+        }
+    }
+    catch (...)
+    {
+        discardChain(std::move(removedChain));
+        throw;
+    }
+    discardChain(std::move(removedChain));
+    return removed;
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::reverse() noexcept
+{
+    if (mLen < 2)
+    {
+        return;
+    }
+
+    auto sent = popTerminator();
+    mTail = mHead;
+
+    auto reversed = std::shared_ptr<ValueNode>();
+    for (auto node = std::move(mHead); node;)
+    {
+        auto next = std::move(node->next);
+        if (reversed)
+        {
+            reversed->prev = node;
+        }
+        node->next = std::move(reversed);
+        reversed = std::move(node);
+        node = std::move(next);
+    }
+
+    mHead = std::move(reversed);
+    mHead->prev.reset();
+    addTerminator(std::move(sent));
+    mLayoutChanges = mLen;
+}
+
+template<typename T, typename Allocator>
+template<typename Pred>
+auto List<T, Allocator>::partition(Pred pred) -> iterator
+{
+    if (empty())
+    {
+        return end();
+    }
+
+    auto sent = popTerminator();
+    auto chain = std::move(mHead);
+    mTail.reset();
+    mTerminator.reset();
+    mLen = 0;
+
+    auto selected = Chain();
+    auto rest = Chain();
+    auto moveAll = [&](Chain& target) {
+        while (chain)
+        {
+            auto next = std::move(chain->next);
+            target.pushTail(std::move(chain));
+            chain = std::move(next);
+        }
+    };
+
+    try
+    {
+        while (chain)
+        {
+            auto& target = std::invoke(pred, std::as_const(chain->value)) ? selected : rest;
+            auto next = std::move(chain->next);
+            target.pushTail(std::move(chain));
+            chain = std::move(next);
+        }
+    }
+    catch (...)
+    {
+        // Порядок не сохраняется, но ни один узел не теряется
+        moveAll(selected);
+        selected.append(std::move(rest));
+        adopt(std::move(selected), std::move(sent));
+        throw;
+    }
+
+    auto boundary = std::weak_ptr<ValueNode>(rest.head);
+    if (selected.size > 0)
+    {
+        mLayoutChanges += rest.size;
+    }
+    selected.append(std::move(rest));
+    adopt(std::move(selected), std::move(sent));
+
+    return boundary.expired() ? end() : iterator(boundary);
+}
+
+template<typename T, typename Allocator>
+template<typename Compare>
+void List<T, Allocator>::merge(List& other, Compare comp)
+{
+    if (this == &other || other.empty())
+    {
+        return;
+    }
+    if (empty())
+    {
+        clear(); // пустой список ещё может держать терминатор
+    }
+
+    auto sent = other.popTerminator();
+    if (!empty())
+    {
+        popTerminator();
+    }
+    auto lhs = std::move(mHead);
+    auto rhs = std::move(other.mHead);
+    mTail.reset();
+    mTerminator.reset();
+    mLen = 0;
+    mLayoutChanges += other.mLen + std::exchange(other.mLayoutChanges, 0);
+    other.mTail.reset();
+    other.mTerminator.reset();
+    other.mLen = 0;
+
+    auto merged = Chain();
+    auto take = [&merged](std::shared_ptr<ValueNode>& chain) {
+        auto next = std::move(chain->next);
+        merged.pushTail(std::move(chain));
+        chain = std::move(next);
+    };
+    auto takeRest = [&] {
+        while (lhs)
+        {
+            take(lhs);
+        }
+        while (rhs)
+        {
+            take(rhs);
+        }
+    };
+
+    try
+    {
+        while (lhs && rhs)
+        {
+            take(std::invoke(comp, std::as_const(rhs->value), std::as_const(lhs->value)) ? rhs : lhs);
+        }
+    }
+    catch (...)
+    {
+        // Порядок не сохраняется, но ни один узел не теряется
+        takeRest();
+        adopt(std::move(merged), std::move(sent));
+        throw;
+    }
+
+    takeRest();
+    adopt(std::move(merged), std::move(sent));
+    maybeCompact();
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::rotate(const_iterator position) -> iterator
+{
+    auto middle = position.validateIterator();
+    if (middle == mHead || !middle->next)
+    {
+        return begin();
+    }
+
+    auto oldHead = iterator(mHead);
+    auto sent = popTerminator();
+    auto oldTail = mTail.lock();
+    auto newTail = middle->prev.lock();
+
+    mHead->prev = oldTail;
+    oldTail->next = std::move(mHead);
+    mHead = std::move(newTail->next);
+    mHead->prev.reset();
+    mTail = newTail;
+    addTerminator(std::move(sent));
+    ++mLayoutChanges;
+
+    return oldHead;
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::unlink(ValueNode* prevNode, ValueNode* node) noexcept -> std::shared_ptr<ValueNode>
+{
+    auto& owner = prevNode ? prevNode->next : mHead;
+    auto removed = std::move(owner);
+    owner = std::move(node->next);
+    owner->prev = std::move(node->prev);
+
+    // Следующий узел без next — терминатор
+    if (!owner->next)
+    {
+        mTail = owner->prev;
+    }
+
+    // Опустевший список, как после popHead, сохраняет терминатор головой
+    --mLen;
+    return removed;
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::adopt(Chain&& chain, std::shared_ptr<ValueNode>&& sentinel) noexcept
+{
+    mLen = chain.size;
+    if (!chain.head)
+    {
+        return;
+    }
+
+    mTail = *chain.tail;
+    mHead = std::move(chain.head);
+    addTerminator(std::move(sentinel));
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::Chain::pushTail(std::shared_ptr<ValueNode>&& node) noexcept
+{
+    auto& slot = tail ? (*tail)->next : head;
+    node->prev = tail ? std::weak_ptr<ValueNode>(*tail) : std::weak_ptr<ValueNode>();
+    slot = std::move(node);
+    tail = &slot;
+    ++size;
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::Chain::append(Chain&& other) noexcept
+{
+    if (!other.head)
+    {
+        return;
+    }
+
+    auto& slot = tail ? (*tail)->next : head;
+    other.head->prev = tail ? std::weak_ptr<ValueNode>(*tail) : std::weak_ptr<ValueNode>();
+    auto otherTail = other.tail == &other.head ? &slot : other.tail;
+    slot = std::move(other.head);
+    tail = otherTail;
+    size += std::exchange(other.size, 0);
+    other.tail = nullptr;
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::compact()
+{
+    if (empty())
+    {
+        return;
+    }
+
+    // Со стандартным распределителем узлы берутся из своего пула, иначе из mAllocator
+    auto compacted = List(mAllocator);
+    auto allocator = [&] {
+        if constexpr (std::is_same_v<Allocator, std::allocator<T>>)
+        {
+            auto pool = std::make_shared<NodePool>(mLen + 1);
+            compacted.mPool = pool;
+            return PoolAllocator<ValueNode>(std::move(pool));
+        }
+        else
+        {
+            return mAllocator;
+        }
+    }();
+    auto last = static_cast<ValueNode*>(nullptr);
+    try
+    {
+        auto node = mHead.get();
+        for (size_type i = 0; i < mLen; ++i, node = node->next.get())
+        {
+            auto copy = ValueNode::allocate(allocator, std::move_if_noexcept(node->value));
+            if (last)
+            {
+                copy->prev = compacted.mTail;
+                last->next = copy;
+            }
+            else
+            {
+                compacted.mHead = copy;
+            }
+            compacted.mTail = copy;
+            last = copy.get();
+        }
+        compacted.addTerminator(ValueNode::allocate(allocator));
+    }
+    catch (...)
+    {
+        // Перемещённые значения возвращаются на место, и список остаётся прежним
+        constexpr auto moved =
+            std::is_nothrow_move_constructible_v<value_type> || !std::is_copy_constructible_v<value_type>;
+        if constexpr (moved)
+        {
+            auto node = mHead.get();
+            for (auto copy = compacted.mHead.get(); copy; copy = copy->next.get(), node = node->next.get())
+            {
+                node->value = std::move(copy->value);
+            }
+        }
+        throw;
+    }
+    compacted.mLen = mLen;
+    compacted.mCompactionThreshold = mCompactionThreshold;
+    compacted.mPrefetchDistance = mPrefetchDistance;
+    compacted.mReclaimer = mReclaimer;
+    compacted.takeReserve(*this);
+
+    swap(compacted);
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::fragmentation() const noexcept -> double
+{
+    if (empty())
+    {
+        return 0.0;
+    }
+    return std::min(1.0, static_cast<double>(mLayoutChanges) / static_cast<double>(mLen));
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::setCompactionThreshold(double threshold) noexcept
+{
+    mCompactionThreshold = threshold;
+}
+
+template<typename T, typename Allocator>
+template<typename Fn>
+void List<T, Allocator>::forEach(Fn fn)
+{
+    walk(mHead.get(), mLen, mPrefetchDistance, fn);
+}
+
+template<typename T, typename Allocator>
+template<typename Fn>
+void List<T, Allocator>::forEach(Fn fn) const
+{
+    // walk отдаёт изменяемые значения, константный список — только для чтения
+    auto read = [&fn](const value_type& value) { fn(value); };
+    walk(mHead.get(), mLen, mPrefetchDistance, read);
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::setPrefetchDistance(size_type distance) noexcept
+{
+    mPrefetchDistance = distance;
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::prefetchDistance() const noexcept -> size_type
+{
+    return mPrefetchDistance;
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::setReclaimer(Reclaimer* reclaimer) noexcept
+{
+    mReclaimer = reclaimer;
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::reclaimer() const noexcept -> Reclaimer*
+{
+    return mReclaimer;
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::release(std::shared_ptr<ValueNode>&& chain, bool wholeChain) noexcept
+{
+    if (mReclaimer)
+    {
+        mReclaimer->retire(std::move(chain), wholeChain);
+        return;
+    }
+    while (chain)
+    {
+        chain = std::move(chain->next);
+    }
+}
+
+// Ведущий указатель идёт на distance узлов впереди и подгружает их,
+// пока fn обрабатывает текущий; число шагов фиксируется заранее,
+// поэтому fn может дописывать в конец этого же списка
+template<typename T, typename Allocator>
+template<typename Fn>
+void List<T, Allocator>::walk(ValueNode* node, size_type count, size_type distance, Fn& fn)
+{
+    auto lead = node;
+    for (size_type i = 0; i < distance && lead; ++i)
+    {
+        lead = lead->next.get();
+        prefetch(lead);
+    }
+
+    for (; count > 0; --count)
+    {
+        if (lead)
+        {
+            lead = lead->next.get();
+            prefetch(lead);
+        }
+        auto next = node->next.get();
+        fn(node->value);
+        node = next;
+    }
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::nodeBlockSize() const -> size_type
+{
+    auto allocate = [](const auto& allocator) { return ValueNode::allocate(allocator); };
+    if constexpr (std::is_same_v<Allocator, std::allocator<T>>)
+    {
+        static const auto size = sharedBlockSize(CachingAllocator<ValueNode>(), allocate);
+        return size;
+    }
+    else
+    {
+        static const auto size = sharedBlockSize(mAllocator, allocate);
+        return size;
+    }
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+auto List<T, Allocator>::makeNode(Args&&... args) -> std::shared_ptr<ValueNode>
+{
+    if constexpr (std::is_same_v<Allocator, std::allocator<T>>)
+    {
+        return ValueNode::allocate(CachingAllocator<ValueNode>(), std::forward<Args>(args)...);
+    }
+    else
+    {
+        return ValueNode::allocate(mAllocator, std::forward<Args>(args)...);
+    }
+}
+
+template<typename T, typename Allocator>
+template<typename... Args>
+auto List<T, Allocator>::takeNode(Args&&... args) -> std::shared_ptr<ValueNode>
+{
+    if constexpr (std::is_move_assignable_v<value_type>)
+    {
+        if (mSpare)
+        {
+            // Значение присваивается до снятия узла, чтобы исключение не потеряло его
+            mSpare->value = value_type(std::forward<Args>(args)...);
+            --mSpareCount;
+            return std::exchange(mSpare, std::move(mSpare->next));
+        }
+    }
+    return makeNode(std::forward<Args>(args)...);
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::recycle(std::shared_ptr<ValueNode>& node) noexcept -> bool
+{
+    if constexpr (std::is_nothrow_default_constructible_v<value_type> && std::is_nothrow_move_assignable_v<value_type>)
+    {
+        if (capacity() < mReserved)
+        {
+            node->value = value_type(); // ресурсы значения не держим в запасе
+            ++node->generation;         // итераторы на снятый элемент становятся висячими
+            node->prev.reset();
+            node->next = std::move(mSpare);
+            mSpare = std::move(node);
+            ++mSpareCount;
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::discard(std::shared_ptr<ValueNode>&& node) noexcept
+{
+    if (node && !recycle(node))
+    {
+        release(std::move(node));
+    }
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::discardChain(std::shared_ptr<ValueNode>&& chain) noexcept
+{
+    while (chain && capacity() < mReserved)
+    {
+        auto next = std::move(chain->next);
+        if (!recycle(chain))
+        {
+            chain->next = std::move(next);
+            break;
+        }
+        chain = std::move(next);
+    }
+
+    // Узлы освобождаются по одному, чтобы длинная цепочка не разворачивалась
+    // в рекурсию деструкторов shared_ptr
+    release(std::move(chain), true);
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::takeReserve(List& from) noexcept
+{
+    release(std::move(mSpare), true);
+    mSpare = std::move(from.mSpare);
+    mSpareCount = std::exchange(from.mSpareCount, 0);
+    mReserved = std::exchange(from.mReserved, 0);
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::reserve(size_type count)
+{
+    mReserved = std::max(mReserved, count);
+    while (capacity() < count)
+    {
+        auto node = makeNode();
+        node->next = std::move(mSpare);
+        mSpare = std::move(node);
+        ++mSpareCount;
+    }
+}
+
+// Пустому списку для первого элемента нужен ещё и терминатор из запаса
+template<typename T, typename Allocator>
+auto List<T, Allocator>::capacity() const noexcept -> size_type
+{
+    auto needsTerminator = mTerminator.expired() && mSpareCount > 0;
+    return mLen + mSpareCount - (needsTerminator ? 1 : 0);
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::shrink_to_fit() noexcept
+{
+    release(std::move(mSpare), true);
+    mSpareCount = 0;
+    mReserved = mLen;
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::memory_usage() const -> MemoryUsage
+{
+    // Терминатор есть у всякого списка с узлами; у опустошённого popHead он в mHead
+    auto nodeCount = mLen + (mHead ? 1 : 0) + mSpareCount;
+    auto pooled = size_type{};
+
+    auto usage = MemoryUsage();
+    usage.payload = mLen * sizeof(value_type);
+    usage.nodes = nodeCount * sizeof(ValueNode) - usage.payload;
+    usage.control = sizeof(*this);
+
+    if constexpr (std::is_same_v<Allocator, std::allocator<T>>)
+    {
+        if (auto pool = mPool.lock())
+        {
+            for (auto chain : {mHead.get(), mSpare.get()})
+            {
+                for (; chain; chain = chain->next.get())
+                {
+                    pooled += pool->owns(chain);
+                }
+            }
+            static const auto poolBlockSize = sharedBlockSize(std::allocator<NodePool>(), [](const auto& allocator) {
+                return std::allocate_shared<NodePool>(allocator, 1);
+            });
+            usage.control += pooled * (pool->blockSize() - sizeof(ValueNode)) + pool->overheadBytes() + poolBlockSize;
+        }
+    }
+    usage.control += (nodeCount - pooled) * (nodeBlockSize() - sizeof(ValueNode));
+    return usage;
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::maybeCompact()
+{
+    if (mCompactionThreshold > 0.0 && mLen >= minCompactionSize && fragmentation() >= mCompactionThreshold)
+    {
+        compact();
+    }
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::peekHead() -> reference
+{
+    if (empty())
+    {
+        throw ListOutOfRangeException("peekHead() called on an empty list");
+    }
+
+    return mHead->value;
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::peekHead() const -> const_reference
+{
+    if (empty())
+    {
+        throw ListOutOfRangeException("peekHead() called on an empty list");
+    }
+
+    return mHead->value;
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::peekTail() -> reference
+{
+    if (empty())
+    {
+        throw ListOutOfRangeException("peekTail() called on an empty list");
+    }
+
+    return mTail.lock()->value;
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::peekTail() const -> const_reference
+{
+    if (empty())
+    {
+        throw ListOutOfRangeException("peekTail() called on an empty list");
+    }
+
+    return mTail.lock()->value;
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::tryPeekHead() noexcept -> pointer
+{
+    return empty() ? nullptr : &mHead->value;
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::tryPeekHead() const noexcept -> const_pointer
+{
+    return empty() ? nullptr : &mHead->value;
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::tryPeekTail() noexcept -> pointer
+{
+    return empty() ? nullptr : &mTail.lock()->value;
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::tryPeekTail() const noexcept -> const_pointer
+{
+    return empty() ? nullptr : &mTail.lock()->value;
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::insertInEmpty(std::shared_ptr<ValueNode>&& node)
+{
+    // Список, опустошённый popHead, держит терминатор в mHead: он остаётся,
+    // и итераторы end() не повисают. Новый выделяется до изменений списка
+    auto sentinel = mHead ? std::move(mHead) : takeNode();
+    mHead = std::move(node);
+    mHead->next = std::move(sentinel);
+    mHead->next->prev = mHead;
+    mTerminator = mHead->next;
+    mTail = mHead;
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::popTerminator() -> std::shared_ptr<ValueNode>
+{
+    return std::move(mTail.lock()->next);
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::addTerminator(std::shared_ptr<ValueNode>&& sentinel)
+{
+    sentinel->prev = mTail;
+    this->mTerminator = sentinel;
+    mTail.lock()->next = std::move(sentinel);
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::pushHead(std::shared_ptr<ValueNode>&& node)
+{
+    if (empty())
+    {
+        insertInEmpty(std::move(node));
+    }
+    else
+    {
+        mHead->prev = node;
+        node->next = std::move(mHead);
+        mHead = std::move(node);
+        ++mLayoutChanges;
+    }
+    ++mLen;
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::pushTail(std::shared_ptr<ValueNode>&& node)
+{
+    if (empty())
+    {
+        insertInEmpty(std::move(node));
+    }
+    else
+    {
+        auto sent = popTerminator();
+        node->prev = mTail;
+        mTail.lock()->next = std::move(node);
+        mTail = mTail.lock()->next;
+        addTerminator(std::move(sent));
+    }
+    ++mLen;
+}
+
+template<typename T, typename Allocator>
+auto List<T, Allocator>::popHead() noexcept -> std::optional<value_type>
 {
     if (empty())
     {
@@ -544,14 +1907,19 @@ auto List<T>::popHead() noexcept -> std::optional<value_type>
     }
 
     auto data = std::move(mHead->value);
-    mHead = std::move(mHead->next);
-    --mLen;
+    auto node = std::exchange(mHead, std::move(mHead->next));
+    mHead->prev.reset(); // снятый узел может освобождаться позже
+    if (--mLen == 0)
+    {
+        mTail.reset(); // слабая ссылка держала бы блок узла вместе с блоком управления
+    }
+    discard(std::move(node));
 
     return data;
 }
 
-template<typename T>
-auto List<T>::popTail() noexcept -> std::optional<value_type>
+template<typename T, typename Allocator>
+auto List<T, Allocator>::popTail() noexcept -> std::optional<value_type>
 {
     if (empty())
     {
@@ -563,22 +1931,137 @@ auto List<T>::popTail() noexcept -> std::optional<value_type>
     mTail = mTail.lock()->prev;
     --mLen;
 
+    auto node = std::shared_ptr<ValueNode>();
     if (!empty())
     {
+        node = std::move(mTail.lock()->next);
         addTerminator(std::move(sent));
     }
     else
     {
-        mHead.reset();
+        node = std::move(mHead);
+        mTerminator.reset();
+    }
+    discard(std::move(node));
+    if (empty())
+    {
+        discard(std::move(sent));
     }
 
     return data;
 }
 
-template<typename T>
-void List<T>::insertBefore(const_iterator position, std::shared_ptr<ValueNode>&& node)
+template<typename T, typename Allocator>
+template<std::weakly_incrementable Out>
+auto List<T, Allocator>::popHeadN(size_type count, Out out) -> Out
+    requires std::indirectly_writable<Out, value_type>
+{
+    count = std::min(count, mLen);
+    if (count == 0)
+    {
+        return out;
+    }
+
+    auto chain = std::shared_ptr<ValueNode>();
+    if (count == mLen)
+    {
+        chain = std::move(mHead);
+        mTail.reset();
+        mTerminator.reset();
+    }
+    else
+    {
+        auto last = mHead.get();
+        for (size_type i = 1; i < count; ++i)
+        {
+            last = last->next.get();
+        }
+
+        chain = std::move(mHead);
+        mHead = std::move(last->next);
+        mHead->prev.reset();
+    }
+    mLen -= count;
+
+    return drainChain(std::move(chain), count, std::move(out));
+}
+
+template<typename T, typename Allocator>
+template<std::weakly_incrementable Out>
+auto List<T, Allocator>::popTailN(size_type count, Out out) -> Out
+    requires std::indirectly_writable<Out, value_type>
+{
+    count = std::min(count, mLen);
+    if (count == 0)
+    {
+        return out;
+    }
+
+    auto last = mTail.lock();
+    auto first = last;
+    for (size_type i = 1; i < count; ++i)
+    {
+        first = first->prev.lock();
+    }
+
+    auto chain = std::shared_ptr<ValueNode>();
+    if (count == mLen)
+    {
+        chain = std::move(mHead);
+        mTail.reset();
+        mTerminator.reset();
+    }
+    else
+    {
+        auto sent = popTerminator();
+        mTail = first->prev;
+        chain = std::move(mTail.lock()->next);
+        chain->prev.reset();
+        addTerminator(std::move(sent));
+    }
+    mLen -= count;
+
+    // Значения выдаются в том же порядке, что и при повторных popTail
+    for (auto node = std::move(last); count > 0; --count)
+    {
+        *out = std::move(node->value);
+        ++out;
+        node = node->prev.lock();
+    }
+    first.reset();
+
+    return drainChain(std::move(chain), 0, std::move(out));
+}
+
+template<typename T, typename Allocator>
+template<typename Container>
+auto List<T, Allocator>::drainTo(Container& container) -> size_type
+    requires requires(Container& c, value_type&& v) { c.push_back(std::move(v)); }
+{
+    auto count = mLen;
+    popHeadN(count, std::back_inserter(container));
+    return count;
+}
+
+template<typename T, typename Allocator>
+template<typename Out>
+auto List<T, Allocator>::drainChain(std::shared_ptr<ValueNode>&& chain, size_type count, Out out) -> Out
+{
+    auto node = chain.get();
+    for (; count > 0; --count, node = node->next.get())
+    {
+        *out = std::move(node->value);
+        ++out;
+    }
+
+    discardChain(std::move(chain));
+    return out;
+}
+
+template<typename T, typename Allocator>
+void List<T, Allocator>::insertBefore(const_iterator position, std::shared_ptr<ValueNode>&& node)
 {
-    position.validateIterator();
+    auto currentNode = position.validateIterator();
 
     if (position == cbegin())
     {
@@ -586,35 +2069,58 @@ void List<T>::insertBefore(const_iterator position, std::shared_ptr<ValueNode>&&
         return;
     }
 
-    auto currentNode = position.currentNode.lock();
     auto prevNode = currentNode->prev.lock();
     node->prev = prevNode;
     node->next = std::move(prevNode->next);
     currentNode->prev = node;
     prevNode->next = std::move(node);
 
+    if (position != cend())
+    {
+        ++mLayoutChanges;
+    }
+    else
+    {
+        mTail = prevNode->next;
+    }
     ++mLen;
 }
 
-template<typename T>
-auto operator+(const List<T>& lhs, const List<T>& rhs) -> List<T>
+template<typename T, typename Allocator>
+auto operator+(const List<T, Allocator>& lhs, const List<T, Allocator>& rhs) -> List<T, Allocator>
 {
-    auto newList = List<T>(lhs);
+    auto newList = List<T, Allocator>(lhs);
     newList += rhs;
     return newList;
 }
 
-template<typename T>
-auto operator<<(std::ostream& os, const mylist::List<T> ls) -> std::ostream&
+// Аналог std::erase_if для List
+template<typename T, typename Allocator, typename Pred>
+auto erase_if(List<T, Allocator>& ls, Pred pred) -> typename List<T, Allocator>::size_type
+{
+    return ls.removeIf(std::move(pred));
+}
+
+template<typename T, typename Allocator>
+auto operator<<(std::ostream& os, const mylist::List<T, Allocator>& ls) -> std::ostream&
 {
     os << "[";
-    for (auto separator = ""; const auto& element : ls)
-    {
+    auto separator = "";
+    ls.forEach([&](const T& element) {
         os << separator << element;
         separator = ", ";
-    }
+    });
     os << "]";
     return os;
 }
 
+namespace pmr
+{
+
+// Список, узлы которого выделяются из std::pmr::memory_resource
+template<typename T>
+using List = mylist::List<T, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+
 } // namespace mylist
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "list.hpp"
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+namespace mylist
+{
+
+// Кэш с вытеснением давно не использованных записей.
+// Порядок хранится в List (голова — самая свежая запись), индекс — хеш-таблица
+// от ключа к итератору; get, put и вытеснение работают за O(1).
+template<typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class LruCache
+{
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<K, V>;
+    using size_type = std::size_t;
+    using const_iterator = typename List<value_type>::const_iterator;
+
+    explicit LruCache(size_type capacity) : mCapacity(capacity) {}
+
+    // Возвращает nullptr при промахе; при попадании запись становится самой свежей
+    auto get(const key_type& key) -> mapped_type*
+    {
+        auto found = mIndex.find(key);
+        if (found == mIndex.end())
+        {
+            ++mMisses;
+            return nullptr;
+        }
+
+        ++mHits;
+        touch(found->second);
+        return &found->second->second;
+    }
+
+    // Поиск без изменения порядка и статистики
+    auto peek(const key_type& key) const -> const mapped_type*
+    {
+        auto found = mIndex.find(key);
+        return found == mIndex.end() ? nullptr : &found->second->second;
+    }
+
+    // Вставляет или обновляет запись. Возвращает вытесненную запись, если она была.
+    // Если новая запись не построилась, кэш не меняется.
+    template<typename Value>
+    auto put(const key_type& key, Value&& value) -> std::optional<value_type>
+        requires std::assignable_from<mapped_type&, Value&&> && std::constructible_from<mapped_type, Value&&>
+    {
+        if (auto found = mIndex.find(key); found != mIndex.end())
+        {
+            found->second->second = std::forward<Value>(value);
+            touch(found->second);
+            return {};
+        }
+
+        if (mCapacity == 0)
+        {
+            return value_type(key, std::forward<Value>(value));
+        }
+
+        // Старая запись вытесняется только после того, как новая встала на
+        // место: если её построение бросит, кэш останется прежним
+        mEntries.emplaceHead(key, std::forward<Value>(value));
+        try
+        {
+            mIndex.emplace(key, mEntries.begin());
+        }
+        catch (...)
+        {
+            mEntries.popHead();
+            throw;
+        }
+
+        if (mEntries.size() > mCapacity)
+        {
+            return evict();
+        }
+        return {};
+    }
+
+    auto erase(const key_type& key) -> bool
+    {
+        auto found = mIndex.find(key);
+        if (found == mIndex.end())
+        {
+            return false;
+        }
+
+        mEntries.erase(found->second);
+        mIndex.erase(found);
+        return true;
+    }
+
+    // Удаляет самую старую запись
+    auto evict() -> std::optional<value_type>
+    {
+        if (mEntries.empty())
+        {
+            return {};
+        }
+
+        mIndex.erase(mEntries.peekTail().first);
+        return mEntries.popTail();
+    }
+
+    auto contains(const key_type& key) const -> bool
+    {
+        return mIndex.contains(key);
+    }
+
+    void clear() noexcept
+    {
+        mIndex.clear();
+        mEntries.clear();
+    }
+
+    auto size() const noexcept -> size_type
+    {
+        return mEntries.size();
+    }
+
+    auto empty() const noexcept -> bool
+    {
+        return mEntries.empty();
+    }
+
+    auto capacity() const noexcept -> size_type
+    {
+        return mCapacity;
+    }
+
+    auto hits() const noexcept -> size_type
+    {
+        return mHits;
+    }
+
+    auto misses() const noexcept -> size_type
+    {
+        return mMisses;
+    }
+
+    // Обход от самой свежей записи к самой старой
+    auto begin() const noexcept -> const_iterator
+    {
+        return mEntries.cbegin();
+    }
+
+    auto end() const noexcept -> const_iterator
+    {
+        return mEntries.cend();
+    }
+
+private:
+    using Entries = List<value_type>;
+
+    Entries mEntries;
+    std::unordered_map<key_type, typename Entries::iterator, Hash, KeyEqual> mIndex;
+    size_type mCapacity;
+    size_type mHits{};
+    size_type mMisses{};
+
+    void touch(typename Entries::iterator it)
+    {
+        mEntries.splice(mEntries.cbegin(), mEntries, it);
+    }
+};
+
+} // namespace mylist
@@ -0,0 +1,729 @@
+#pragma once
+
+#include "_exceptions.hpp"
+#include <array>
+#include <cerrno>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <optional>
+#include <ostream>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace mylist
+{
+
+// Двусвязный список в отображённом в память файле (POSIX mmap).
+// Узлы лежат массивом сразу за заголовком и ссылаются друг на друга
+// смещениями внутри массива, а не указателями, поэтому файл не зависит
+// от адреса отображения: повторное открытие — это один mmap без разбора
+// и без выделения памяти под узлы. Ячейка 0 — фиктивная граница, как у
+// StaticList; при нехватке места файл удваивается и отображается заново.
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+class MappedList
+{
+    using offset_type = std::uint64_t;
+
+    static constexpr offset_type npos = std::numeric_limits<offset_type>::max();
+    static constexpr offset_type sentinel = 0;
+    static constexpr offset_type initialCapacity = 64;
+
+    struct Node
+    {
+        offset_type prev;
+        offset_type next;
+        T value;
+    };
+
+    struct Header
+    {
+        std::array<char, 8> magic;
+        std::uint64_t valueSize;
+        std::uint64_t valueAlign;
+        offset_type capacity; // ячеек в файле вместе с границей
+        offset_type used;     // ячейки выше ещё ни разу не выдавались
+        offset_type free;
+        std::uint64_t size;
+    };
+
+    static constexpr auto magic = std::array<char, 8>{'M', 'L', 'M', 'A', 'P', 'P', 'E', 'D'};
+    static constexpr std::size_t nodesOffset = (sizeof(Header) + alignof(Node) - 1) / alignof(Node) * alignof(Node);
+
+    template<bool Const>
+    class BasicIterator
+    {
+        friend class MappedList;
+        friend class BasicIterator<!Const>;
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using iterator_concept = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+        using reference = std::conditional_t<Const, const value_type&, value_type&>;
+
+        BasicIterator() = default;
+
+        template<bool OtherConst>
+        BasicIterator(const BasicIterator<OtherConst>& that)
+            requires(Const && !OtherConst)
+            : mList(that.mList), mOffset(that.mOffset)
+        {
+        }
+
+        auto operator++() -> BasicIterator&
+        {
+            validateIterator();
+            mOffset = mList->node(mOffset).next;
+            return *this;
+        }
+
+        auto operator++(int) -> BasicIterator
+        {
+            auto oldIt = *this;
+            ++(*this);
+            return oldIt;
+        }
+
+        auto operator--() -> BasicIterator&
+        {
+            validateIterator();
+            mOffset = mList->node(mOffset).prev;
+            return *this;
+        }
+
+        auto operator--(int) -> BasicIterator
+        {
+            auto oldIt = *this;
+            --(*this);
+            return oldIt;
+        }
+
+        auto operator*() const -> reference
+        {
+            validateIterator();
+            if (mOffset == sentinel)
+            {
+                throw ListOutOfRangeException("Trying to dereference the end of the list");
+            }
+            return mList->node(mOffset).value;
+        }
+
+        auto operator->() const -> pointer
+        {
+            return &**this;
+        }
+
+        friend auto operator==(const BasicIterator& lhs, const BasicIterator& rhs) -> bool
+        {
+            return lhs.mOffset == rhs.mOffset && lhs.mList == rhs.mList;
+        }
+
+        auto dangling() const noexcept -> bool
+        {
+            return mList == nullptr || mList->mBase == nullptr || (mOffset != sentinel && !mList->live(mOffset));
+        }
+
+    private:
+        using list_pointer = std::conditional_t<Const, const MappedList*, MappedList*>;
+
+        // Смещение, а не адрес узла: итератор переживает переотображение файла
+        list_pointer mList{};
+        offset_type mOffset{};
+
+        BasicIterator(list_pointer list, offset_type offset) : mList(list), mOffset(offset) {}
+
+        auto validateIterator() const -> void
+        {
+            if (dangling())
+            {
+                throw DanglingIteratorException("Trying to dereference dangling iterator");
+            }
+        }
+    };
+
+public:
+    using value_type = T;
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using size_type = std::size_t;
+
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    // Открывает список из файла или создаёт пустой, если файла нет или он пуст
+    explicit MappedList(const std::filesystem::path& path);
+    MappedList(const MappedList&) = delete;
+
+    // Перемещённый список можно только присвоить или разрушить
+    MappedList(MappedList&& that) noexcept;
+    ~MappedList();
+
+    auto operator=(const MappedList&) -> MappedList& = delete;
+    auto operator=(MappedList&& that) noexcept -> MappedList&;
+
+    auto peekHead() -> reference;
+    auto peekHead() const -> const_reference;
+    auto peekTail() -> reference;
+    auto peekTail() const -> const_reference;
+
+    auto popHead() -> std::optional<value_type>;
+    auto popTail() -> std::optional<value_type>;
+
+    void pushHead(const value_type& element);
+    void pushTail(const value_type& element);
+
+    // Псевдоним `pushHead` для совместимости с front_inserter
+    void push_front(const value_type& element);
+
+    // Псевдоним `pushTail` для совместимости с back_inserter
+    void push_back(const value_type& element);
+
+    auto insertBefore(const_iterator position, const value_type& value) -> iterator;
+    auto insertAfter(const_iterator position, const value_type& value) -> iterator;
+
+    // Псевдоним `insertBefore` для совместимости с inserter
+    auto insert(const_iterator position, const value_type& value) -> iterator;
+
+    auto erase(const_iterator position) -> iterator;
+    void clear() noexcept;
+
+    // Сбрасывает изменения на диск; без вызова это сделает ядро в своё время
+    void flush();
+
+    void swap(MappedList& other) noexcept;
+
+    auto size() const noexcept -> size_type
+    {
+        return header().size;
+    }
+
+    auto empty() const noexcept -> bool
+    {
+        return size() == 0;
+    }
+
+    // Сколько элементов поместится без увеличения файла
+    auto capacity() const noexcept -> size_type
+    {
+        return header().capacity - 1;
+    }
+
+    auto begin() noexcept -> iterator
+    {
+        return iterator(this, node(sentinel).next);
+    }
+
+    auto begin() const noexcept -> const_iterator
+    {
+        return cbegin();
+    }
+
+    auto end() noexcept -> iterator
+    {
+        return iterator(this, sentinel);
+    }
+
+    auto end() const noexcept -> const_iterator
+    {
+        return cend();
+    }
+
+    auto cbegin() const noexcept -> const_iterator
+    {
+        return const_iterator(this, node(sentinel).next);
+    }
+
+    auto cend() const noexcept -> const_iterator
+    {
+        return const_iterator(this, sentinel);
+    }
+
+    auto rbegin() noexcept -> reverse_iterator
+    {
+        return reverse_iterator(end());
+    }
+
+    auto rend() noexcept -> reverse_iterator
+    {
+        return reverse_iterator(begin());
+    }
+
+    auto crbegin() const noexcept -> const_reverse_iterator
+    {
+        return const_reverse_iterator(cend());
+    }
+
+    auto crend() const noexcept -> const_reverse_iterator
+    {
+        return const_reverse_iterator(cbegin());
+    }
+
+private:
+    int mFd{-1};
+    std::byte* mBase{};
+    std::size_t mMappedSize{};
+
+    static constexpr auto fileSize(offset_type capacity) noexcept -> std::size_t
+    {
+        return nodesOffset + capacity * sizeof(Node);
+    }
+
+    [[noreturn]] static void throwSystemError(const char* what)
+    {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    auto header() noexcept -> Header&
+    {
+        return *std::launder(reinterpret_cast<Header*>(mBase));
+    }
+
+    auto header() const noexcept -> const Header&
+    {
+        return *std::launder(reinterpret_cast<const Header*>(mBase));
+    }
+
+    auto node(offset_type offset) noexcept -> Node&
+    {
+        return std::launder(reinterpret_cast<Node*>(mBase + nodesOffset))[offset];
+    }
+
+    auto node(offset_type offset) const noexcept -> const Node&
+    {
+        return std::launder(reinterpret_cast<const Node*>(mBase + nodesOffset))[offset];
+    }
+
+    auto live(offset_type offset) const noexcept -> bool
+    {
+        return offset != sentinel && offset <= header().used && node(offset).prev != npos;
+    }
+
+    void map(std::size_t bytes);
+    void unmap() noexcept;
+    void initialize();
+    void validate(std::size_t bytes) const;
+    void grow();
+
+    auto acquireSlot(const value_type& value) -> offset_type;
+    void linkBefore(offset_type position, offset_type offset) noexcept;
+    auto extract(offset_type offset) noexcept -> value_type;
+    void validatePosition(const_iterator position) const;
+};
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+MappedList<T>::MappedList(const std::filesystem::path& path)
+{
+    mFd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (mFd < 0)
+    {
+        throwSystemError("Couldn't open mapped list file");
+    }
+
+    try
+    {
+        struct stat info
+        {
+        };
+        if (::fstat(mFd, &info) != 0)
+        {
+            throwSystemError("Couldn't stat mapped list file");
+        }
+
+        auto bytes = static_cast<std::size_t>(info.st_size);
+        if (bytes == 0)
+        {
+            initialize();
+        }
+        else
+        {
+            if (bytes < fileSize(1))
+            {
+                throw MappedListFormatException("Mapped list file is truncated");
+            }
+            map(bytes);
+            validate(bytes);
+        }
+    }
+    catch (...)
+    {
+        unmap();
+        ::close(mFd);
+        throw;
+    }
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+MappedList<T>::MappedList(MappedList&& that) noexcept
+    : mFd(std::exchange(that.mFd, -1)), mBase(std::exchange(that.mBase, nullptr)),
+      mMappedSize(std::exchange(that.mMappedSize, 0))
+{
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+MappedList<T>::~MappedList()
+{
+    unmap();
+    if (mFd >= 0)
+    {
+        ::close(mFd);
+    }
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+auto MappedList<T>::operator=(MappedList&& that) noexcept -> MappedList&
+{
+    auto moved = std::move(that);
+    swap(moved);
+    return *this;
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+auto MappedList<T>::peekHead() -> reference
+{
+    if (empty())
+    {
+        throw ListOutOfRangeException("peekHead() called on an empty list");
+    }
+    return node(node(sentinel).next).value;
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+auto MappedList<T>::peekHead() const -> const_reference
+{
+    if (empty())
+    {
+        throw ListOutOfRangeException("peekHead() called on an empty list");
+    }
+    return node(node(sentinel).next).value;
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+auto MappedList<T>::peekTail() -> reference
+{
+    if (empty())
+    {
+        throw ListOutOfRangeException("peekTail() called on an empty list");
+    }
+    return node(node(sentinel).prev).value;
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+auto MappedList<T>::peekTail() const -> const_reference
+{
+    if (empty())
+    {
+        throw ListOutOfRangeException("peekTail() called on an empty list");
+    }
+    return node(node(sentinel).prev).value;
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+auto MappedList<T>::popHead() -> std::optional<value_type>
+{
+    if (empty())
+    {
+        return {};
+    }
+    return extract(node(sentinel).next);
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+auto MappedList<T>::popTail() -> std::optional<value_type>
+{
+    if (empty())
+    {
+        return {};
+    }
+    return extract(node(sentinel).prev);
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+void MappedList<T>::pushHead(const value_type& element)
+{
+    auto offset = acquireSlot(element);
+    linkBefore(node(sentinel).next, offset);
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+void MappedList<T>::pushTail(const value_type& element)
+{
+    linkBefore(sentinel, acquireSlot(element));
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+void MappedList<T>::push_front(const value_type& element)
+{
+    pushHead(element);
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+void MappedList<T>::push_back(const value_type& element)
+{
+    pushTail(element);
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+auto MappedList<T>::insertBefore(const_iterator position, const value_type& value) -> iterator
+{
+    validatePosition(position);
+    auto offset = acquireSlot(value);
+    linkBefore(position.mOffset, offset);
+    return iterator(this, offset);
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+auto MappedList<T>::insertAfter(const_iterator position, const value_type& value) -> iterator
+{
+    validatePosition(position);
+    if (position == cend())
+    {
+        throw ListOutOfRangeException("Couldn't insert after the end of the list");
+    }
+    return insertBefore(std::next(position), value);
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+auto MappedList<T>::insert(const_iterator position, const value_type& value) -> iterator
+{
+    return insertBefore(position, value);
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+auto MappedList<T>::erase(const_iterator position) -> iterator
+{
+    validatePosition(position);
+    if (position == cend())
+    {
+        throw ListOutOfRangeException("Couldn't erase the end of the list");
+    }
+
+    auto next = node(position.mOffset).next;
+    extract(position.mOffset);
+    return iterator(this, next);
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+void MappedList<T>::clear() noexcept
+{
+    // Файл не уменьшается: ячейки остаются и выдаются заново
+    auto& head = header();
+    head.used = 0;
+    head.free = npos;
+    head.size = 0;
+    node(sentinel).prev = sentinel;
+    node(sentinel).next = sentinel;
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+void MappedList<T>::flush()
+{
+    if (::msync(mBase, mMappedSize, MS_SYNC) != 0)
+    {
+        throwSystemError("Couldn't flush mapped list");
+    }
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+void MappedList<T>::swap(MappedList& other) noexcept
+{
+    std::swap(mFd, other.mFd);
+    std::swap(mBase, other.mBase);
+    std::swap(mMappedSize, other.mMappedSize);
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+void MappedList<T>::map(std::size_t bytes)
+{
+    auto address = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, mFd, 0);
+    if (address == MAP_FAILED)
+    {
+        throwSystemError("Couldn't map list file");
+    }
+    mBase = static_cast<std::byte*>(address);
+    mMappedSize = bytes;
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+void MappedList<T>::unmap() noexcept
+{
+    if (mBase)
+    {
+        ::munmap(mBase, mMappedSize);
+        mBase = nullptr;
+        mMappedSize = 0;
+    }
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+void MappedList<T>::initialize()
+{
+    if (::ftruncate(mFd, static_cast<off_t>(fileSize(initialCapacity))) != 0)
+    {
+        throwSystemError("Couldn't resize mapped list file");
+    }
+    map(fileSize(initialCapacity));
+    ::new (mBase) Header{magic, sizeof(T), alignof(T), initialCapacity, 0, npos, 0};
+    node(sentinel).prev = sentinel;
+    node(sentinel).next = sentinel;
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+void MappedList<T>::validate(std::size_t bytes) const
+{
+    const auto& head = header();
+    if (head.magic != magic)
+    {
+        throw MappedListFormatException("Not a mapped list file");
+    }
+    if (head.valueSize != sizeof(T) || head.valueAlign != alignof(T))
+    {
+        throw MappedListFormatException("Mapped list file holds another value type");
+    }
+    if (head.capacity == 0 || head.capacity > (bytes - nodesOffset) / sizeof(Node) || head.used >= head.capacity
+        || head.size > head.used || (head.free != npos && (head.free == sentinel || head.free > head.used)))
+    {
+        throw MappedListFormatException("Mapped list file is corrupted");
+    }
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+void MappedList<T>::grow()
+{
+    auto capacity = header().capacity * 2;
+    if (::ftruncate(mFd, static_cast<off_t>(fileSize(capacity))) != 0)
+    {
+        throwSystemError("Couldn't resize mapped list file");
+    }
+
+    // Связи — смещения, поэтому после переотображения ничего не правится
+    auto old = std::exchange(mBase, nullptr);
+    auto oldSize = mMappedSize;
+    try
+    {
+        map(fileSize(capacity));
+    }
+    catch (...)
+    {
+        mBase = old;
+        throw;
+    }
+    ::munmap(old, oldSize);
+    header().capacity = capacity;
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+auto MappedList<T>::acquireSlot(const value_type& value) -> offset_type
+{
+    // value может лежать в самом отображении, которое grow() снимает
+    auto copy = value;
+    auto& head = header();
+    if (head.free == npos && head.used + 1 == head.capacity)
+    {
+        grow();
+    }
+
+    auto& current = header();
+    auto offset = current.free != npos ? current.free : ++current.used;
+    if (offset == current.free)
+    {
+        current.free = node(offset).next;
+    }
+    ::new (&node(offset).value) value_type(copy);
+    return offset;
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+void MappedList<T>::linkBefore(offset_type position, offset_type offset) noexcept
+{
+    auto prev = node(position).prev;
+    node(offset).prev = prev;
+    node(offset).next = position;
+    node(prev).next = offset;
+    node(position).prev = offset;
+    ++header().size;
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+auto MappedList<T>::extract(offset_type offset) noexcept -> value_type
+{
+    auto& current = node(offset);
+    node(current.prev).next = current.next;
+    node(current.next).prev = current.prev;
+    current.prev = npos;
+    current.next = header().free;
+    header().free = offset;
+    --header().size;
+    return current.value;
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T> && std::copy_constructible<T>
+void MappedList<T>::validatePosition(const_iterator position) const
+{
+    if (position.mList != this)
+    {
+        throw ListOutOfRangeException("Iterator belongs to another list");
+    }
+    position.validateIterator();
+}
+
+template<typename T>
+auto operator<<(std::ostream& os, const MappedList<T>& ls) -> std::ostream&
+{
+    os << "[";
+    for (auto separator = ""; const auto& element : ls)
+    {
+        os << separator << element;
+        separator = ", ";
+    }
+    os << "]";
+    return os;
+}
+
+} // namespace mylist
@@ -0,0 +1,274 @@
+#pragma once
+
+#include "list.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <utility>
+
+namespace mylist
+{
+
+// Что делать со вставкой в заполненный RingList
+enum class Overflow
+{
+    overwriteOldest, // узел с противоположного конца переиспользуется под новый элемент
+    rejectNew,       // новый элемент отбрасывается
+};
+
+// Список из не более чем capacity последних элементов. Когда он заполнен,
+// вставка не выделяет и не освобождает узлы: снятый с противоположного
+// конца узел уходит в запас List (см. List::reserve) и сразу же получает
+// новое значение. Обход и вывод — как у List.
+template<typename T, typename Allocator = std::allocator<T>>
+class RingList
+{
+    using Items = List<T, Allocator>;
+
+public:
+    using value_type = T;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using size_type = std::size_t;
+    using allocator_type = Allocator;
+
+    using iterator = typename Items::iterator;
+    using const_iterator = typename Items::const_iterator;
+    using reverse_iterator = typename Items::reverse_iterator;
+    using const_reverse_iterator = typename Items::const_reverse_iterator;
+
+    explicit RingList(size_type capacity, Overflow policy = Overflow::overwriteOldest)
+        : mCapacity(capacity), mPolicy(policy)
+    {
+    }
+
+    RingList(size_type capacity, Overflow policy, const allocator_type& allocator)
+        : mItems(allocator), mCapacity(capacity), mPolicy(policy)
+    {
+    }
+
+    auto peekHead() -> reference
+    {
+        return mItems.peekHead();
+    }
+
+    auto peekHead() const -> const_reference
+    {
+        return mItems.peekHead();
+    }
+
+    auto peekTail() -> reference
+    {
+        return mItems.peekTail();
+    }
+
+    auto peekTail() const -> const_reference
+    {
+        return mItems.peekTail();
+    }
+
+    auto popHead() noexcept -> std::optional<value_type>
+    {
+        return mItems.popHead();
+    }
+
+    auto popTail() noexcept -> std::optional<value_type>
+    {
+        return mItems.popTail();
+    }
+
+    // Возвращают false, если элемент не попал в список. При переполнении
+    // с overwriteOldest pushTail вытесняет голову, pushHead — хвост.
+    auto pushTail(std::convertible_to<value_type> auto&& element) -> bool
+    {
+        if (!full())
+        {
+            mItems.pushTail(std::forward<decltype(element)>(element));
+            return true;
+        }
+        if (!overwrite())
+        {
+            return false;
+        }
+
+        // Значение готовится до вытеснения, чтобы исключение не тронуло список
+        auto value = value_type(std::forward<decltype(element)>(element));
+        mItems.popHead();
+        mItems.pushTail(std::move(value));
+        return true;
+    }
+
+    auto pushHead(std::convertible_to<value_type> auto&& element) -> bool
+    {
+        if (!full())
+        {
+            mItems.pushHead(std::forward<decltype(element)>(element));
+            return true;
+        }
+        if (!overwrite())
+        {
+            return false;
+        }
+
+        auto value = value_type(std::forward<decltype(element)>(element));
+        mItems.popTail();
+        mItems.pushHead(std::move(value));
+        return true;
+    }
+
+    // Псевдоним `pushHead` для совместимости с front_inserter
+    auto push_front(std::convertible_to<value_type> auto&& element) -> bool
+    {
+        return pushHead(std::forward<decltype(element)>(element));
+    }
+
+    // Псевдоним `pushTail` для совместимости с back_inserter
+    auto push_back(std::convertible_to<value_type> auto&& element) -> bool
+    {
+        return pushTail(std::forward<decltype(element)>(element));
+    }
+
+    void clear() noexcept
+    {
+        mItems.clear();
+    }
+
+    auto size() const noexcept -> size_type
+    {
+        return mItems.size();
+    }
+
+    auto empty() const noexcept -> bool
+    {
+        return mItems.empty();
+    }
+
+    auto full() const noexcept -> bool
+    {
+        return mItems.size() >= mCapacity;
+    }
+
+    auto capacity() const noexcept -> size_type
+    {
+        return mCapacity;
+    }
+
+    auto policy() const noexcept -> Overflow
+    {
+        return mPolicy;
+    }
+
+    // Элементы, потерянные из-за переполнения: вытесненные или отброшенные
+    auto dropped() const noexcept -> size_type
+    {
+        return mDropped;
+    }
+
+    auto items() const noexcept -> const Items&
+    {
+        return mItems;
+    }
+
+    // Память списка с запасом под вытеснение; поля RingList — служебные
+    auto memory_usage() const -> MemoryUsage
+    {
+        auto usage = mItems.memory_usage();
+        usage.control += sizeof(*this) - sizeof(mItems);
+        return usage;
+    }
+
+    friend auto operator==(const RingList& lhs, const RingList& rhs) -> bool
+    {
+        return std::ranges::equal(lhs.mItems, rhs.mItems);
+    }
+
+    auto begin() noexcept -> iterator
+    {
+        return mItems.begin();
+    }
+
+    auto end() noexcept -> iterator
+    {
+        return mItems.end();
+    }
+
+    auto begin() const noexcept -> const_iterator
+    {
+        return mItems.cbegin();
+    }
+
+    auto end() const noexcept -> const_iterator
+    {
+        return mItems.cend();
+    }
+
+    auto cbegin() const noexcept -> const_iterator
+    {
+        return mItems.cbegin();
+    }
+
+    auto cend() const noexcept -> const_iterator
+    {
+        return mItems.cend();
+    }
+
+    auto rbegin() noexcept -> reverse_iterator
+    {
+        return mItems.rbegin();
+    }
+
+    auto rend() noexcept -> reverse_iterator
+    {
+        return mItems.rend();
+    }
+
+    auto rbegin() const noexcept -> const_reverse_iterator
+    {
+        return mItems.crbegin();
+    }
+
+    auto rend() const noexcept -> const_reverse_iterator
+    {
+        return mItems.crend();
+    }
+
+    auto crbegin() const noexcept -> const_reverse_iterator
+    {
+        return mItems.crbegin();
+    }
+
+    auto crend() const noexcept -> const_reverse_iterator
+    {
+        return mItems.crend();
+    }
+
+private:
+    Items mItems;
+    size_type mCapacity;
+    Overflow mPolicy;
+    size_type mDropped{};
+
+    // Учитывает потерю элемента; true, если политика велит перезаписать.
+    // Список уже заполнен, так что reserve ничего не выделяет, а только
+    // оставляет вытесняемый узел в запасе до следующей вставки
+    auto overwrite() -> bool
+    {
+        ++mDropped;
+        if (mPolicy != Overflow::overwriteOldest || mCapacity == 0)
+        {
+            return false;
+        }
+        mItems.reserve(mCapacity);
+        return true;
+    }
+};
+
+template<typename T, typename Allocator>
+auto operator<<(std::ostream& os, const RingList<T, Allocator>& ls) -> std::ostream&
+{
+    return os << ls.items();
+}
+
+} // namespace mylist
@@ -0,0 +1,230 @@
+#pragma once
+
+#include "list.hpp"
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <ranges>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace mylist
+{
+
+// Последовательность, в которую дописывают многие потоки. У каждого потока
+// свой шард — обычный List, поэтому pushTail не берёт блокировок и не
+// делит строки кэша с другими потоками; мьютекс нужен только при первой
+// записи потока и когда поток переключается между списками. Чтение,
+// collect() и clear() не должны идти одновременно с записью: их вызывают,
+// когда писатели остановлены или синхронизированы.
+template<typename T, typename Allocator = std::allocator<T>>
+class ShardedList
+{
+public:
+    using list_type = List<T, Allocator>;
+    using value_type = T;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using size_type = std::size_t;
+    using allocator_type = Allocator;
+
+    ShardedList() = default;
+    explicit ShardedList(const allocator_type& allocator) : mAllocator(allocator) {}
+
+    // Потоки запоминают адреса шардов, поэтому список не копируется и не перемещается
+    ShardedList(const ShardedList&) = delete;
+    auto operator=(const ShardedList&) -> ShardedList& = delete;
+
+    // Шард вызывающего потока; первое обращение потока заводит его
+    auto local() -> list_type&
+    {
+        // Поток помнит только последний шард: номера списков не повторяются,
+        // так что запись разрушенного списка просто не совпадёт. Остальные
+        // шарды ищутся по потоку в самом списке и уходят вместе с ним
+        thread_local auto last = std::pair<std::uint64_t, list_type*>();
+        if (last.first == mId)
+        {
+            return *last.second;
+        }
+
+        auto lock = std::lock_guard(mMutex);
+        auto& shard = mThreadShards[std::this_thread::get_id()];
+        if (!shard)
+        {
+            shard = &mShards.emplace_back(mAllocator).items;
+        }
+        last = {mId, shard};
+        return *shard;
+    }
+
+    void pushTail(std::convertible_to<value_type> auto&& element)
+    {
+        local().pushTail(std::forward<decltype(element)>(element));
+    }
+
+    // Псевдоним `pushTail` для совместимости с back_inserter
+    void push_back(std::convertible_to<value_type> auto&& element)
+    {
+        pushTail(std::forward<decltype(element)>(element));
+    }
+
+    template<typename... Args>
+    auto emplaceTail(Args&&... args) -> reference
+        requires std::constructible_from<value_type, Args...>
+    {
+        return local().emplaceTail(std::forward<Args>(args)...);
+    }
+
+    auto shardCount() const -> size_type
+    {
+        auto lock = std::lock_guard(mMutex);
+        return mShards.size();
+    }
+
+    auto size() const -> size_type
+    {
+        auto lock = std::lock_guard(mMutex);
+        auto total = size_type{};
+        for (const auto& shard : mShards)
+        {
+            total += shard.items.size();
+        }
+        return total;
+    }
+
+    auto empty() const -> bool
+    {
+        return size() == 0;
+    }
+
+    // Сумма по шардам. Выравнивание шардов считается служебной памятью;
+    // карта блоков deque в учёт не попадает: её размер знает только реализация
+    auto memory_usage() const -> MemoryUsage
+    {
+        auto lock = std::lock_guard(mMutex);
+        auto usage = MemoryUsage();
+        usage.control = sizeof(*this);
+        for (const auto& shard : mShards)
+        {
+            usage += shard.items.memory_usage();
+            usage.control += sizeof(Shard) - sizeof(list_type);
+        }
+        return usage;
+    }
+
+    // Шарды подряд в порядке их заведения, внутри шарда — в порядке записи
+    auto view() const
+    {
+        return mShards | std::views::transform([](const Shard& shard) -> const list_type& { return shard.items; })
+             | std::views::join;
+    }
+
+    template<typename Fn>
+    void forEach(Fn fn) const
+    {
+        auto lock = std::lock_guard(mMutex);
+        for (const auto& shard : mShards)
+        {
+            shard.items.forEach(fn);
+        }
+    }
+
+    // Сшивает шарды в один список за O(шардов), сохраняя порядок внутри
+    // каждого потока. Шарды остаются заведёнными и пустыми.
+    auto collect() -> list_type
+    {
+        auto lock = std::lock_guard(mMutex);
+        auto result = list_type(mAllocator);
+        for (auto& shard : mShards)
+        {
+            result.append(std::move(shard.items));
+        }
+        return result;
+    }
+
+    // Слияние шардов по ключу key(element), например по номеру или времени
+    // события. Каждый шард уже должен быть упорядочен по ключу; при равных
+    // ключах раньше идёт шард, заведённый раньше. Шарды сливаются попарно
+    // через List::merge: узлы перевязываются без копирования значений,
+    // за O(n log шардов).
+    template<typename Key>
+    auto collect(Key key) -> list_type
+        requires std::totally_ordered<std::invoke_result_t<Key&, const value_type&>>
+    {
+        auto lock = std::lock_guard(mMutex);
+        auto runs = std::vector<list_type>();
+        for (auto& shard : mShards)
+        {
+            if (!shard.items.empty())
+            {
+                runs.push_back(std::move(shard.items));
+            }
+        }
+        if (runs.empty())
+        {
+            return list_type(mAllocator);
+        }
+
+        auto less = [&key](const value_type& lhs, const value_type& rhs) {
+            return std::invoke(key, lhs) < std::invoke(key, rhs);
+        };
+        for (size_type step = 1; step < runs.size(); step *= 2)
+        {
+            for (size_type i = 0; i + step < runs.size(); i += 2 * step)
+            {
+                runs[i].merge(runs[i + step], less);
+            }
+        }
+        return std::move(runs.front());
+    }
+
+    void clear()
+    {
+        auto lock = std::lock_guard(mMutex);
+        for (auto& shard : mShards)
+        {
+            shard.items.clear();
+        }
+    }
+
+private:
+    // Шарды разных потоков не делят строку кэша
+    struct alignas(64) Shard
+    {
+        explicit Shard(const allocator_type& allocator) : items(allocator) {}
+
+        list_type items;
+    };
+
+    static inline std::atomic<std::uint64_t> nextId{1};
+
+    allocator_type mAllocator{};
+    std::uint64_t mId{nextId.fetch_add(1)};
+    mutable std::mutex mMutex;
+    std::deque<Shard> mShards; // deque не двигает шарды при заведении новых
+    std::unordered_map<std::thread::id, list_type*> mThreadShards;
+};
+
+template<typename T, typename Allocator>
+auto operator<<(std::ostream& os, const ShardedList<T, Allocator>& ls) -> std::ostream&
+{
+    os << "[";
+    auto separator = "";
+    ls.forEach([&](const T& element) {
+        os << separator << element;
+        separator = ", ";
+    });
+    os << "]";
+    return os;
+}
+
+} // namespace mylist
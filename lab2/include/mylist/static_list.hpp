@@ -0,0 +1,521 @@
+#pragma once
+
+#include "_exceptions.hpp"
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace mylist
+{
+
+// Двусвязный список фиксированной ёмкости без динамической памяти.
+// Все операции constexpr, поэтому список можно собрать при компиляции
+// и положить в constexpr-переменную: никакой работы при запуске.
+// Устроен как VectorList: индексные связи, ячейка 0 — фиктивная граница.
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+class StaticList
+{
+    using index_type = std::uint32_t;
+
+    static constexpr index_type npos = std::numeric_limits<index_type>::max();
+    static constexpr index_type sentinel = 0;
+
+    static_assert(N < npos, "StaticList capacity is too large");
+
+    struct Link
+    {
+        index_type prev;
+        index_type next;
+    };
+
+    template<bool Const>
+    class BasicIterator
+    {
+        friend class StaticList;
+        friend class BasicIterator<!Const>;
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using iterator_concept = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+        using reference = std::conditional_t<Const, const value_type&, value_type&>;
+
+        constexpr BasicIterator() = default;
+
+        template<bool OtherConst>
+        constexpr BasicIterator(const BasicIterator<OtherConst>& that)
+            requires(Const && !OtherConst)
+            : mList(that.mList), mIndex(that.mIndex)
+        {
+        }
+
+        constexpr auto operator++() -> BasicIterator&
+        {
+            validateIterator();
+            mIndex = mList->mLinks[mIndex].next;
+            return *this;
+        }
+
+        constexpr auto operator++(int) -> BasicIterator
+        {
+            auto oldIt = *this;
+            ++(*this);
+            return oldIt;
+        }
+
+        constexpr auto operator--() -> BasicIterator&
+        {
+            validateIterator();
+            mIndex = mList->mLinks[mIndex].prev;
+            return *this;
+        }
+
+        constexpr auto operator--(int) -> BasicIterator
+        {
+            auto oldIt = *this;
+            --(*this);
+            return oldIt;
+        }
+
+        constexpr auto operator*() const -> reference
+        {
+            validateIterator();
+            if (mIndex == sentinel)
+            {
+                throw ListOutOfRangeException("Trying to dereference the end of the list");
+            }
+            return mList->mValues[mIndex - 1];
+        }
+
+        constexpr auto operator->() const -> pointer
+        {
+            return &**this;
+        }
+
+        friend constexpr auto operator==(const BasicIterator& lhs, const BasicIterator& rhs) -> bool
+        {
+            return lhs.mIndex == rhs.mIndex && lhs.mList == rhs.mList;
+        }
+
+        constexpr auto dangling() const noexcept -> bool
+        {
+            return mList == nullptr || (mIndex != sentinel && !mList->live(mIndex));
+        }
+
+    private:
+        using list_pointer = std::conditional_t<Const, const StaticList*, StaticList*>;
+
+        list_pointer mList{};
+        index_type mIndex{};
+
+        constexpr BasicIterator(list_pointer list, index_type index) : mList(list), mIndex(index) {}
+
+        constexpr auto validateIterator() const -> void
+        {
+            if (dangling())
+            {
+                throw DanglingIteratorException("Trying to dereference dangling iterator");
+            }
+        }
+    };
+
+public:
+    using value_type = T;
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using size_type = std::size_t;
+
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    constexpr StaticList() = default;
+    constexpr StaticList(std::initializer_list<value_type> list);
+
+    template<std::input_iterator It>
+    constexpr StaticList(It begin, It end)
+        requires std::convertible_to<typename std::iterator_traits<It>::value_type, value_type>;
+
+    constexpr auto peekHead() -> reference;
+    constexpr auto peekHead() const -> const_reference;
+    constexpr auto peekTail() -> reference;
+    constexpr auto peekTail() const -> const_reference;
+
+    constexpr auto popHead() -> std::optional<value_type>;
+    constexpr auto popTail() -> std::optional<value_type>;
+
+    constexpr void pushHead(std::convertible_to<value_type> auto&& element);
+    constexpr void pushTail(std::convertible_to<value_type> auto&& element);
+
+    // Псевдоним `pushHead` для совместимости с front_inserter
+    constexpr void push_front(std::convertible_to<value_type> auto&& element);
+
+    // Псевдоним `pushTail` для совместимости с back_inserter
+    constexpr void push_back(std::convertible_to<value_type> auto&& element);
+
+    constexpr auto insertBefore(const_iterator position, std::convertible_to<value_type> auto&& value) -> iterator;
+    constexpr auto insertAfter(const_iterator position, std::convertible_to<value_type> auto&& value) -> iterator;
+
+    // Псевдоним `insertBefore` для совместимости с inserter
+    constexpr auto insert(const_iterator position, std::convertible_to<value_type> auto&& value) -> iterator;
+
+    constexpr auto erase(const_iterator position) -> iterator;
+    constexpr void clear() noexcept;
+
+    constexpr auto size() const noexcept -> size_type
+    {
+        return mLen;
+    }
+
+    constexpr auto empty() const noexcept -> bool
+    {
+        return mLen == 0;
+    }
+
+    constexpr auto full() const noexcept -> bool
+    {
+        return mLen == N;
+    }
+
+    static constexpr auto capacity() noexcept -> size_type
+    {
+        return N;
+    }
+
+    // Сравнение значений в порядке обхода
+    friend constexpr auto operator==(const StaticList& lhs, const StaticList& rhs) -> bool
+    {
+        return std::ranges::equal(lhs, rhs);
+    }
+
+    constexpr auto begin() noexcept -> iterator
+    {
+        return iterator(this, mLinks[sentinel].next);
+    }
+
+    constexpr auto begin() const noexcept -> const_iterator
+    {
+        return cbegin();
+    }
+
+    constexpr auto end() noexcept -> iterator
+    {
+        return iterator(this, sentinel);
+    }
+
+    constexpr auto end() const noexcept -> const_iterator
+    {
+        return cend();
+    }
+
+    constexpr auto cbegin() const noexcept -> const_iterator
+    {
+        return const_iterator(this, mLinks[sentinel].next);
+    }
+
+    constexpr auto cend() const noexcept -> const_iterator
+    {
+        return const_iterator(this, sentinel);
+    }
+
+    constexpr auto rbegin() noexcept -> reverse_iterator
+    {
+        return reverse_iterator(end());
+    }
+
+    constexpr auto rend() noexcept -> reverse_iterator
+    {
+        return reverse_iterator(begin());
+    }
+
+    constexpr auto crbegin() const noexcept -> const_reverse_iterator
+    {
+        return const_reverse_iterator(cend());
+    }
+
+    constexpr auto crend() const noexcept -> const_reverse_iterator
+    {
+        return const_reverse_iterator(cbegin());
+    }
+
+private:
+    // Ячейка i хранит значение в mValues[i - 1]; у свободной ячейки prev == npos.
+    // Ячейки выше mUsed ещё ни разу не выдавались.
+    std::array<Link, N + 1> mLinks{};
+    std::array<value_type, N> mValues{};
+    size_type mLen{};
+    index_type mUsed{};
+    index_type mFree{npos};
+
+    constexpr auto live(index_type index) const noexcept -> bool
+    {
+        return index != sentinel && index <= mUsed && mLinks[index].prev != npos;
+    }
+
+    constexpr auto acquireSlot(auto&& value) -> index_type;
+    constexpr void linkBefore(index_type position, index_type index) noexcept;
+    constexpr auto extract(index_type index) -> value_type;
+    constexpr void validatePosition(const_iterator position) const;
+};
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+constexpr StaticList<T, N>::StaticList(std::initializer_list<value_type> list) : StaticList(list.begin(), list.end())
+{
+}
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+template<std::input_iterator It>
+constexpr StaticList<T, N>::StaticList(It begin, It end)
+    requires std::convertible_to<typename std::iterator_traits<It>::value_type, value_type>
+{
+    for (; begin != end; ++begin)
+    {
+        pushTail(*begin);
+    }
+}
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+constexpr auto StaticList<T, N>::peekHead() -> reference
+{
+    if (empty())
+    {
+        throw ListOutOfRangeException("peekHead() called on an empty list");
+    }
+    return mValues[mLinks[sentinel].next - 1];
+}
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+constexpr auto StaticList<T, N>::peekHead() const -> const_reference
+{
+    if (empty())
+    {
+        throw ListOutOfRangeException("peekHead() called on an empty list");
+    }
+    return mValues[mLinks[sentinel].next - 1];
+}
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+constexpr auto StaticList<T, N>::peekTail() -> reference
+{
+    if (empty())
+    {
+        throw ListOutOfRangeException("peekTail() called on an empty list");
+    }
+    return mValues[mLinks[sentinel].prev - 1];
+}
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+constexpr auto StaticList<T, N>::peekTail() const -> const_reference
+{
+    if (empty())
+    {
+        throw ListOutOfRangeException("peekTail() called on an empty list");
+    }
+    return mValues[mLinks[sentinel].prev - 1];
+}
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+constexpr auto StaticList<T, N>::popHead() -> std::optional<value_type>
+{
+    if (empty())
+    {
+        return {};
+    }
+    return extract(mLinks[sentinel].next);
+}
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+constexpr auto StaticList<T, N>::popTail() -> std::optional<value_type>
+{
+    if (empty())
+    {
+        return {};
+    }
+    return extract(mLinks[sentinel].prev);
+}
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+constexpr void StaticList<T, N>::pushHead(std::convertible_to<value_type> auto&& element)
+{
+    linkBefore(mLinks[sentinel].next, acquireSlot(std::forward<decltype(element)>(element)));
+}
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+constexpr void StaticList<T, N>::pushTail(std::convertible_to<value_type> auto&& element)
+{
+    linkBefore(sentinel, acquireSlot(std::forward<decltype(element)>(element)));
+}
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+constexpr void StaticList<T, N>::push_front(std::convertible_to<value_type> auto&& element)
+{
+    pushHead(std::forward<decltype(element)>(element));
+}
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+constexpr void StaticList<T, N>::push_back(std::convertible_to<value_type> auto&& element)
+{
+    pushTail(std::forward<decltype(element)>(element));
+}
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+constexpr auto StaticList<T, N>::insertBefore(const_iterator position, std::convertible_to<value_type> auto&& value)
+    -> iterator
+{
+    validatePosition(position);
+    auto index = acquireSlot(std::forward<decltype(value)>(value));
+    linkBefore(position.mIndex, index);
+    return iterator(this, index);
+}
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+constexpr auto StaticList<T, N>::insertAfter(const_iterator position, std::convertible_to<value_type> auto&& value)
+    -> iterator
+{
+    validatePosition(position);
+    if (position == cend())
+    {
+        throw ListOutOfRangeException("Couldn't insert after the end of the list");
+    }
+    return insertBefore(std::next(position), std::forward<decltype(value)>(value));
+}
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+constexpr auto StaticList<T, N>::insert(const_iterator position, std::convertible_to<value_type> auto&& value)
+    -> iterator
+{
+    return insertBefore(position, std::forward<decltype(value)>(value));
+}
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+constexpr auto StaticList<T, N>::erase(const_iterator position) -> iterator
+{
+    validatePosition(position);
+    if (position == cend())
+    {
+        throw ListOutOfRangeException("Couldn't erase the end of the list");
+    }
+
+    auto next = mLinks[position.mIndex].next;
+    extract(position.mIndex);
+    return iterator(this, next);
+}
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+constexpr void StaticList<T, N>::clear() noexcept
+{
+    for (index_type index = 1; index <= mUsed; ++index)
+    {
+        mValues[index - 1] = value_type();
+    }
+    mLinks = {};
+    mLen = 0;
+    mUsed = 0;
+    mFree = npos;
+}
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+constexpr auto StaticList<T, N>::acquireSlot(auto&& value) -> index_type
+{
+    if (full())
+    {
+        throw ListOutOfRangeException("StaticList capacity exceeded");
+    }
+
+    // Счётчики меняются только после присваивания, которое может бросить
+    auto index = mFree != npos ? mFree : static_cast<index_type>(mUsed + 1);
+    mValues[index - 1] = std::forward<decltype(value)>(value);
+    if (index == mFree)
+    {
+        mFree = mLinks[index].next;
+    }
+    else
+    {
+        ++mUsed;
+    }
+    return index;
+}
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+constexpr void StaticList<T, N>::linkBefore(index_type position, index_type index) noexcept
+{
+    auto prev = mLinks[position].prev;
+    mLinks[index] = {prev, position};
+    mLinks[prev].next = index;
+    mLinks[position].prev = index;
+    ++mLen;
+}
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+constexpr auto StaticList<T, N>::extract(index_type index) -> value_type
+{
+    auto [prev, next] = mLinks[index];
+    mLinks[prev].next = next;
+    mLinks[next].prev = prev;
+    mLinks[index] = {npos, mFree};
+    mFree = index;
+    --mLen;
+
+    return std::exchange(mValues[index - 1], value_type());
+}
+
+template<typename T, std::size_t N>
+    requires std::default_initializable<T> && std::movable<T>
+constexpr void StaticList<T, N>::validatePosition(const_iterator position) const
+{
+    if (position.mList != this)
+    {
+        throw ListOutOfRangeException("Iterator belongs to another list");
+    }
+    position.validateIterator();
+}
+
+template<typename T, std::size_t N>
+auto operator<<(std::ostream& os, const StaticList<T, N>& ls) -> std::ostream&
+{
+    os << "[";
+    for (auto separator = ""; const auto& element : ls)
+    {
+        os << separator << element;
+        separator = ", ";
+    }
+    os << "]";
+    return os;
+}
+
+} // namespace mylist
@@ -0,0 +1,344 @@
+#pragma once
+
+#include "_exceptions.hpp"
+#include "vector_list.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace mylist
+{
+
+// Хранилище байтов строк, в которое только дописывают. Строки копируются
+// в крупные блоки и больше никогда не двигаются, поэтому string_view на
+// них живут столько же, сколько арена. С интернированием одинаковые
+// строки хранятся один раз. Не потокобезопасна.
+class StringArena
+{
+public:
+    static constexpr std::size_t blockSize = 16 * 1024;
+
+    explicit StringArena(bool interning = false) : mInterning(interning) {}
+
+    StringArena(const StringArena&) = delete;
+    auto operator=(const StringArena&) -> StringArena& = delete;
+
+    // Копирует строку в арену (или находит уже сохранённую)
+    auto store(std::string_view str) -> std::string_view
+    {
+        if (mInterning)
+        {
+            if (auto found = mInterned.find(str); found != mInterned.end())
+            {
+                return *found;
+            }
+        }
+
+        auto stored = copy(str);
+        if (mInterning)
+        {
+            mInterned.insert(stored);
+        }
+        return stored;
+    }
+
+    auto interning() const noexcept -> bool
+    {
+        return mInterning;
+    }
+
+    // Байты строк, записанных в арену
+    auto usedBytes() const noexcept -> std::size_t
+    {
+        return mUsed;
+    }
+
+    // Байты, взятые у системы под блоки
+    auto reservedBytes() const noexcept -> std::size_t
+    {
+        return mReserved;
+    }
+
+private:
+    std::vector<std::unique_ptr<char[]>> mBlocks;
+    char* mCursor{};
+    std::size_t mRemaining{};
+    std::size_t mUsed{};
+    std::size_t mReserved{};
+    bool mInterning;
+    std::unordered_set<std::string_view> mInterned;
+
+    auto copy(std::string_view str) -> std::string_view
+    {
+        if (str.empty())
+        {
+            return {};
+        }
+
+        // Длинные строки получают свой блок, чтобы не бросать остаток текущего
+        if (str.size() > blockSize / 4)
+        {
+            auto block = allocateBlock(str.size());
+            std::memcpy(block, str.data(), str.size());
+            mUsed += str.size();
+            return {block, str.size()};
+        }
+
+        if (str.size() > mRemaining)
+        {
+            mCursor = allocateBlock(blockSize);
+            mRemaining = blockSize;
+        }
+        auto stored = std::string_view(mCursor, str.size());
+        std::memcpy(mCursor, str.data(), str.size());
+        mCursor += str.size();
+        mRemaining -= str.size();
+        mUsed += str.size();
+        return stored;
+    }
+
+    auto allocateBlock(std::size_t size) -> char*
+    {
+        mBlocks.reserve(mBlocks.size() + 1);
+        mBlocks.push_back(std::make_unique_for_overwrite<char[]>(size));
+        mReserved += size;
+        return mBlocks.back().get();
+    }
+};
+
+// Список строк без отдельного буфера на каждую: байты лежат в общей
+// арене, узлы — ячейками VectorList, элементы доступны как string_view.
+// Копии списка делят арену, поэтому копирование не трогает байты строк.
+// Арена только растёт: удалённые строки остаются в ней до её разрушения,
+// и извлечённые popHead/popTail значения живы, пока жива арена.
+class StringList
+{
+    using Nodes = VectorList<std::string_view>;
+
+public:
+    using value_type = std::string_view;
+    using reference = const value_type&;
+    using const_reference = const value_type&;
+    using size_type = std::size_t;
+
+    using iterator = Nodes::const_iterator;
+    using const_iterator = Nodes::const_iterator;
+    using reverse_iterator = Nodes::const_reverse_iterator;
+    using const_reverse_iterator = Nodes::const_reverse_iterator;
+
+    StringList() : StringList(std::make_shared<StringArena>()) {}
+
+    // Список поверх заданной арены; несколько списков могут делить одну
+    explicit StringList(std::shared_ptr<StringArena> arena) : mArena(std::move(arena)) {}
+
+    StringList(std::initializer_list<value_type> list) : StringList()
+    {
+        append(list.begin(), list.end());
+    }
+
+    template<std::input_iterator It>
+    StringList(It begin, It end)
+        requires std::convertible_to<std::iter_reference_t<It>, value_type>
+        : StringList()
+    {
+        append(begin, end);
+    }
+
+    auto peekHead() const -> value_type
+    {
+        return mNodes.peekHead();
+    }
+
+    auto peekTail() const -> value_type
+    {
+        return mNodes.peekTail();
+    }
+
+    auto popHead() noexcept -> std::optional<value_type>
+    {
+        return mNodes.popHead();
+    }
+
+    auto popTail() noexcept -> std::optional<value_type>
+    {
+        return mNodes.popTail();
+    }
+
+    void pushHead(value_type str)
+    {
+        mNodes.pushHead(mArena->store(str));
+    }
+
+    void pushTail(value_type str)
+    {
+        mNodes.pushTail(mArena->store(str));
+    }
+
+    // Псевдоним `pushHead` для совместимости с front_inserter
+    void push_front(value_type str)
+    {
+        pushHead(str);
+    }
+
+    // Псевдоним `pushTail` для совместимости с back_inserter
+    void push_back(value_type str)
+    {
+        pushTail(str);
+    }
+
+    void insertBefore(const_iterator position, value_type str)
+    {
+        mNodes.insertBefore(position, mArena->store(str));
+    }
+
+    void insertAfter(const_iterator position, value_type str)
+    {
+        mNodes.insertAfter(position, mArena->store(str));
+    }
+
+    // Псевдоним `insertBefore` для совместимости с inserter
+    void insert(const_iterator position, value_type str)
+    {
+        insertBefore(position, str);
+    }
+
+    auto erase(const_iterator position) -> const_iterator
+    {
+        return mNodes.erase(position);
+    }
+
+    // Строки из той же арены не копируются
+    void append(const StringList& that)
+    {
+        if (that.mArena == mArena)
+        {
+            mNodes.append(that.mNodes);
+            return;
+        }
+        append(that.begin(), that.end());
+    }
+
+    template<std::input_iterator It>
+    void append(It begin, It end)
+        requires std::convertible_to<std::iter_reference_t<It>, value_type>
+    {
+        for (; begin != end; ++begin)
+        {
+            pushTail(*begin);
+        }
+    }
+
+    auto operator+=(const StringList& that) -> StringList&
+    {
+        append(that);
+        return *this;
+    }
+
+    // Убирает элементы, байты строк остаются в арене
+    void clear() noexcept
+    {
+        mNodes.clear();
+    }
+
+    void reserve(size_type count)
+    {
+        mNodes.reserve(count);
+    }
+
+    auto size() const noexcept -> size_type
+    {
+        return mNodes.size();
+    }
+
+    auto empty() const noexcept -> bool
+    {
+        return mNodes.empty();
+    }
+
+    auto arena() const noexcept -> const StringArena&
+    {
+        return *mArena;
+    }
+
+    // Ячейки узлов и вся арена, даже если её делят с другими списками
+    auto storageBytes() const noexcept -> size_type
+    {
+        return mNodes.capacity() * slotBytes + mArena->reservedBytes();
+    }
+
+    friend auto operator==(const StringList& lhs, const StringList& rhs) -> bool
+    {
+        return std::ranges::equal(lhs, rhs);
+    }
+
+    auto begin() const noexcept -> const_iterator
+    {
+        return mNodes.cbegin();
+    }
+
+    auto end() const noexcept -> const_iterator
+    {
+        return mNodes.cend();
+    }
+
+    auto cbegin() const noexcept -> const_iterator
+    {
+        return mNodes.cbegin();
+    }
+
+    auto cend() const noexcept -> const_iterator
+    {
+        return mNodes.cend();
+    }
+
+    auto rbegin() const noexcept -> const_reverse_iterator
+    {
+        return mNodes.crbegin();
+    }
+
+    auto rend() const noexcept -> const_reverse_iterator
+    {
+        return mNodes.crend();
+    }
+
+    auto crbegin() const noexcept -> const_reverse_iterator
+    {
+        return mNodes.crbegin();
+    }
+
+    auto crend() const noexcept -> const_reverse_iterator
+    {
+        return mNodes.crend();
+    }
+
+private:
+    // Ячейка VectorList: значение и две индексные связи
+    static constexpr size_type slotBytes = sizeof(value_type) + 2 * sizeof(std::uint32_t);
+
+    std::shared_ptr<StringArena> mArena;
+    Nodes mNodes;
+};
+
+inline auto operator<<(std::ostream& os, const StringList& ls) -> std::ostream&
+{
+    os << "[";
+    for (auto separator = ""; auto str : ls)
+    {
+        os << separator << str;
+        separator = ", ";
+    }
+    os << "]";
+    return os;
+}
+
+} // namespace mylist
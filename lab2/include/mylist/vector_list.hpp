@@ -0,0 +1,1088 @@
+#pragma once
+
+#include "_exceptions.hpp"
+#include "_kernels.hpp"
+#include "list.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mylist
+{
+
+// Двусвязный список в одном непрерывном хранилище.
+// Узлы связаны 32-битными индексами, освободившиеся ячейки уходят во
+// внутренний список свободных. Значения и связи лежат в отдельных массивах,
+// ячейка 0 — фиктивная граница кольца. Пока элементы занимают ячейки
+// 1..size() в порядке обхода (список только дописывали в конец и снимали
+// с конца), значения лежат сплошным массивом: для тривиально копируемых
+// типов копирование идёт через memcpy, а для арифметических поиск, подсчёт,
+// минимум, максимум и сравнение — векторизуемыми циклами из _kernels.hpp.
+template<typename T>
+class VectorList : public ListBase
+{
+    using index_type = std::uint32_t;
+
+    static constexpr index_type npos = std::numeric_limits<index_type>::max();
+    static constexpr index_type sentinel = 0;
+
+    struct Link
+    {
+        index_type prev;
+        index_type next;
+    };
+
+    template<bool Const>
+    class BasicIterator
+    {
+        friend class VectorList;
+        friend class BasicIterator<!Const>;
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using iterator_concept = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+        using reference = std::conditional_t<Const, const value_type&, value_type&>;
+
+        BasicIterator() = default;
+
+        template<bool OtherConst>
+        BasicIterator(const BasicIterator<OtherConst>& that)
+            requires(Const && !OtherConst)
+            : mList(that.mList), mIndex(that.mIndex)
+        {
+        }
+
+        auto operator++() -> BasicIterator&
+        {
+            validateIterator();
+            mIndex = mList->mLinks[mIndex].next;
+            return *this;
+        }
+
+        auto operator++(int) -> BasicIterator
+        {
+            auto oldIt = *this;
+            ++(*this);
+            return oldIt;
+        }
+
+        auto operator--() -> BasicIterator&
+        {
+            validateIterator();
+            mIndex = mList->mLinks[mIndex].prev;
+            return *this;
+        }
+
+        auto operator--(int) -> BasicIterator
+        {
+            auto oldIt = *this;
+            --(*this);
+            return oldIt;
+        }
+
+        auto operator*() const -> reference
+        {
+            validateIterator();
+            if (mIndex == sentinel)
+            {
+                throw ListOutOfRangeException("Trying to dereference the end of the list");
+            }
+            return mList->mValues[mIndex];
+        }
+
+        auto operator->() const -> pointer
+        {
+            return &**this;
+        }
+
+        friend auto operator==(const BasicIterator& lhs, const BasicIterator& rhs) -> bool
+        {
+            return lhs.mIndex == rhs.mIndex && lhs.mList == rhs.mList;
+        }
+
+        // Освобождённая ячейка распознаётся, пока её не заняли снова
+        auto dangling() const noexcept -> bool
+        {
+            return mList == nullptr || mIndex >= mList->mLinks.size()
+                || (mIndex != sentinel && !mList->live(mIndex));
+        }
+
+    private:
+        using list_pointer = std::conditional_t<Const, const VectorList*, VectorList*>;
+
+        list_pointer mList{};
+        index_type mIndex{};
+
+        BasicIterator(list_pointer list, index_type index) : mList(list), mIndex(index) {}
+
+        auto validateIterator() const -> void
+        {
+            if (dangling())
+            {
+                throw DanglingIteratorException("Trying to dereference dangling iterator");
+            }
+        }
+    };
+
+public:
+    using value_type = T;
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using size_type = ListBase::size_type;
+
+    using iterator = BasicIterator<false>;
+    using const_iterator = BasicIterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    ~VectorList();
+
+    VectorList();
+    VectorList(std::initializer_list<value_type> list);
+    VectorList(const VectorList& that);
+    VectorList(size_type count, value_type value = value_type());
+    VectorList(VectorList&& that) noexcept;
+
+    template<std::input_iterator It>
+    VectorList(It begin, It end)
+        requires std::convertible_to<typename std::iterator_traits<It>::value_type, value_type>;
+
+    template<std::ranges::input_range Rng>
+    VectorList(const Rng& range)
+        requires std::convertible_to<typename std::iterator_traits<std::ranges::iterator_t<Rng>>::value_type,
+                                     value_type>;
+
+    auto operator=(const VectorList& that) -> VectorList&;
+    auto operator=(VectorList&& that) noexcept -> VectorList&;
+
+    auto peekHead() -> reference;
+    auto peekHead() const -> const_reference;
+    auto peekTail() -> reference;
+    auto peekTail() const -> const_reference;
+
+    auto popHead() noexcept -> std::optional<value_type>;
+    auto popTail() noexcept -> std::optional<value_type>;
+
+    template<std::weakly_incrementable Out>
+    auto popHeadN(size_type count, Out out) -> Out
+        requires std::indirectly_writable<Out, value_type>;
+
+    template<std::weakly_incrementable Out>
+    auto popTailN(size_type count, Out out) -> Out
+        requires std::indirectly_writable<Out, value_type>;
+
+    template<typename Container>
+    auto drainTo(Container& container) -> size_type
+        requires requires(Container& c, value_type&& v) { c.push_back(std::move(v)); };
+
+    void pushHead(std::convertible_to<value_type> auto&& element);
+    void pushTail(std::convertible_to<value_type> auto&& element);
+
+    // Псевдоним `pushHead` для совместимости с front_inserter
+    void push_front(std::convertible_to<value_type> auto&& element);
+
+    // Псевдоним `pushTail` для совместимости с back_inserter
+    void push_back(std::convertible_to<value_type> auto&& element);
+
+    template<typename... Args>
+    auto emplaceHead(Args&&... args) -> reference
+        requires std::constructible_from<value_type, Args...>;
+
+    template<typename... Args>
+    auto emplaceTail(Args&&... args) -> reference
+        requires std::constructible_from<value_type, Args...>;
+
+    void insertBefore(const_iterator position, std::convertible_to<value_type> auto&& value);
+    void insertAfter(const_iterator position, std::convertible_to<value_type> auto&& value);
+
+    // Псевдоним `insertBefore` для совместимости с inserter
+    void insert(const_iterator position, std::convertible_to<value_type> auto&& value);
+
+    template<typename... Args>
+    auto emplaceBefore(const_iterator position, Args&&... args) -> iterator
+        requires std::constructible_from<value_type, Args...>;
+
+    template<typename... Args>
+    auto emplaceAfter(const_iterator position, Args&&... args) -> iterator
+        requires std::constructible_from<value_type, Args...>;
+
+    template<typename... Args>
+    auto emplace(const_iterator position, Args&&... args) -> iterator
+        requires std::constructible_from<value_type, Args...>;
+
+    auto operator+=(const VectorList& that) -> VectorList&;
+    auto operator+=(VectorList&& that) -> VectorList&;
+    void append(const VectorList& that);
+    void append(VectorList&& that);
+
+    template<std::ranges::input_range Rng>
+    void append(const Rng& range)
+        requires std::convertible_to<typename Rng::value_type, value_type>;
+
+    template<std::input_iterator It>
+    void append(It begin, It end)
+        requires std::convertible_to<typename std::iterator_traits<It>::value_type, value_type>;
+
+    void clear() noexcept;
+    void swap(VectorList& other) noexcept;
+
+    // Копирует элементы в порядке обхода, возвращает итератор за последним
+    template<std::weakly_incrementable Out>
+    auto copyTo(Out out) const -> Out
+        requires std::indirectly_writable<Out, const value_type&>;
+
+    auto find(const value_type& value) -> iterator
+        requires std::equality_comparable<value_type>;
+    auto find(const value_type& value) const -> const_iterator
+        requires std::equality_comparable<value_type>;
+
+    auto count(const value_type& value) const -> size_type
+        requires std::equality_comparable<value_type>;
+
+    // Пустое значение для пустого списка
+    auto min() const -> std::optional<value_type>
+        requires std::totally_ordered<value_type>;
+    auto max() const -> std::optional<value_type>
+        requires std::totally_ordered<value_type>;
+
+    // Сравнение значений в порядке обхода
+    friend auto operator==(const VectorList& lhs, const VectorList& rhs) -> bool
+        requires std::equality_comparable<value_type>
+    {
+        if constexpr (Vectorizable<value_type>)
+        {
+            if (lhs.mOrdered && rhs.mOrdered)
+            {
+                return lhs.mLen == rhs.mLen && equalValues(lhs.mValues + 1, rhs.mValues + 1, lhs.mLen);
+            }
+        }
+        return std::ranges::equal(lhs, rhs);
+    }
+
+    // Удаляет элемент, возвращает итератор на следующий
+    auto erase(const_iterator position) -> iterator;
+
+    // Ёмкость хранилища в элементах, без учёта фиктивной границы
+    auto capacity() const noexcept -> size_type
+    {
+        return mCapacity > 0 ? mCapacity - 1 : 0;
+    }
+
+    void reserve(size_type count);
+
+    // Переупорядочивает узлы в порядке обхода и отдаёт лишнюю память.
+    // Все итераторы становятся недействительными.
+    void shrink_to_fit();
+
+    auto begin() noexcept -> iterator
+    {
+        return iterator(this, mLinks[sentinel].next);
+    }
+
+    auto begin() const noexcept -> const_iterator
+    {
+        return cbegin();
+    }
+
+    auto end() noexcept -> iterator
+    {
+        return iterator(this, sentinel);
+    }
+
+    auto end() const noexcept -> const_iterator
+    {
+        return cend();
+    }
+
+    auto cbegin() const noexcept -> const_iterator
+    {
+        return const_iterator(this, mLinks[sentinel].next);
+    }
+
+    auto cend() const noexcept -> const_iterator
+    {
+        return const_iterator(this, sentinel);
+    }
+
+    auto rbegin() noexcept -> reverse_iterator
+    {
+        return reverse_iterator(end());
+    }
+
+    auto rend() noexcept -> reverse_iterator
+    {
+        return reverse_iterator(begin());
+    }
+
+    auto crbegin() const noexcept -> const_reverse_iterator
+    {
+        return const_reverse_iterator(cend());
+    }
+
+    auto crend() const noexcept -> const_reverse_iterator
+    {
+        return const_reverse_iterator(cbegin());
+    }
+
+private:
+    using Allocator = std::allocator<value_type>;
+    using AllocTraits = std::allocator_traits<Allocator>;
+
+    static constexpr size_type minCapacity = 8;
+
+    // Связи всех занятых и свободных ячеек; у свободной prev == npos
+    std::vector<Link> mLinks;
+    pointer mValues{};
+    size_type mCapacity{};
+    index_type mFree{npos};
+    bool mOrdered{true}; // элементы занимают ячейки 1..mLen в порядке обхода
+
+    auto live(index_type index) const noexcept -> bool
+    {
+        return index != sentinel && mLinks[index].prev != npos;
+    }
+
+    void resetLinks();
+    void reallocate(size_type capacity);
+    void grow();
+
+    template<typename... Args>
+    auto constructSlot(Args&&... args) -> index_type;
+
+    // Дописывает count значений одним memcpy, если список упорядочен
+    auto appendTrivially(const value_type* values, size_type count) -> bool;
+
+    void linkBefore(index_type position, index_type index) noexcept;
+    void unlink(index_type index) noexcept;
+    auto extract(index_type index) noexcept -> value_type;
+    void destroySlot(index_type index) noexcept;
+};
+
+template<typename T>
+VectorList<T>::VectorList()
+{
+    reallocate(minCapacity);
+}
+
+template<typename T>
+VectorList<T>::~VectorList()
+{
+    clear();
+    if (mValues)
+    {
+        Allocator().deallocate(mValues, mCapacity);
+    }
+}
+
+template<typename T>
+template<std::input_iterator It>
+VectorList<T>::VectorList(It begin, It end)
+    requires std::convertible_to<typename std::iterator_traits<It>::value_type, value_type>
+    : VectorList()
+{
+    if constexpr (std::forward_iterator<It>)
+    {
+        reserve(static_cast<size_type>(std::ranges::distance(begin, end)));
+    }
+    append(begin, end);
+}
+
+template<typename T>
+VectorList<T>::VectorList(size_type count, value_type value) : VectorList()
+{
+    reserve(count);
+    for (size_type i = 0; i < count; ++i)
+    {
+        pushTail(value);
+    }
+}
+
+template<typename T>
+VectorList<T>::VectorList(VectorList&& that) noexcept
+    : mLinks(std::move(that.mLinks)), mValues(std::exchange(that.mValues, nullptr)),
+      mCapacity(std::exchange(that.mCapacity, 0)), mFree(std::exchange(that.mFree, npos)),
+      mOrdered(std::exchange(that.mOrdered, true))
+{
+    mLen = std::exchange(that.mLen, 0);
+    that.resetLinks();
+}
+
+// Копия всегда плотная: узлы идут в порядке обхода
+template<typename T>
+VectorList<T>::VectorList(const VectorList& that) : VectorList()
+{
+    append(that);
+}
+
+template<typename T>
+VectorList<T>::VectorList(std::initializer_list<value_type> list) : VectorList(list.begin(), list.end())
+{
+}
+
+template<typename T>
+template<std::ranges::input_range Rng>
+VectorList<T>::VectorList(const Rng& range)
+    requires std::convertible_to<typename std::iterator_traits<std::ranges::iterator_t<Rng>>::value_type, value_type>
+    : VectorList(std::ranges::begin(range), std::ranges::end(range))
+{
+}
+
+template<typename T>
+auto VectorList<T>::operator=(const VectorList& that) -> VectorList&
+{
+    if (this != &that)
+    {
+        VectorList(that).swap(*this);
+    }
+    return *this;
+}
+
+template<typename T>
+auto VectorList<T>::operator=(VectorList&& that) noexcept -> VectorList&
+{
+    if (this != &that)
+    {
+        VectorList(std::move(that)).swap(*this);
+    }
+    return *this;
+}
+
+template<typename T>
+auto VectorList<T>::peekHead() -> reference
+{
+    if (empty())
+    {
+        throw ListOutOfRangeException("peekHead() called on an empty list");
+    }
+
+    return mValues[mLinks[sentinel].next];
+}
+
+template<typename T>
+auto VectorList<T>::peekHead() const -> const_reference
+{
+    if (empty())
+    {
+        throw ListOutOfRangeException("peekHead() called on an empty list");
+    }
+
+    return mValues[mLinks[sentinel].next];
+}
+
+template<typename T>
+auto VectorList<T>::peekTail() -> reference
+{
+    if (empty())
+    {
+        throw ListOutOfRangeException("peekTail() called on an empty list");
+    }
+
+    return mValues[mLinks[sentinel].prev];
+}
+
+template<typename T>
+auto VectorList<T>::peekTail() const -> const_reference
+{
+    if (empty())
+    {
+        throw ListOutOfRangeException("peekTail() called on an empty list");
+    }
+
+    return mValues[mLinks[sentinel].prev];
+}
+
+template<typename T>
+auto VectorList<T>::popHead() noexcept -> std::optional<value_type>
+{
+    if (empty())
+    {
+        return {};
+    }
+
+    return extract(mLinks[sentinel].next);
+}
+
+template<typename T>
+auto VectorList<T>::popTail() noexcept -> std::optional<value_type>
+{
+    if (empty())
+    {
+        return {};
+    }
+
+    return extract(mLinks[sentinel].prev);
+}
+
+template<typename T>
+template<std::weakly_incrementable Out>
+auto VectorList<T>::popHeadN(size_type count, Out out) -> Out
+    requires std::indirectly_writable<Out, value_type>
+{
+    for (count = std::min(count, mLen); count > 0; --count)
+    {
+        *out = extract(mLinks[sentinel].next);
+        ++out;
+    }
+    return out;
+}
+
+template<typename T>
+template<std::weakly_incrementable Out>
+auto VectorList<T>::popTailN(size_type count, Out out) -> Out
+    requires std::indirectly_writable<Out, value_type>
+{
+    for (count = std::min(count, mLen); count > 0; --count)
+    {
+        *out = extract(mLinks[sentinel].prev);
+        ++out;
+    }
+    return out;
+}
+
+template<typename T>
+template<typename Container>
+auto VectorList<T>::drainTo(Container& container) -> size_type
+    requires requires(Container& c, value_type&& v) { c.push_back(std::move(v)); }
+{
+    auto count = mLen;
+    popHeadN(count, std::back_inserter(container));
+    return count;
+}
+
+template<typename T>
+void VectorList<T>::pushHead(std::convertible_to<value_type> auto&& element)
+{
+    linkBefore(mLinks[sentinel].next, constructSlot(std::forward<decltype(element)>(element)));
+}
+
+template<typename T>
+void VectorList<T>::pushTail(std::convertible_to<value_type> auto&& element)
+{
+    linkBefore(sentinel, constructSlot(std::forward<decltype(element)>(element)));
+}
+
+template<typename T>
+void VectorList<T>::push_front(std::convertible_to<value_type> auto&& element)
+{
+    pushHead(std::forward<decltype(element)>(element));
+}
+
+template<typename T>
+void VectorList<T>::push_back(std::convertible_to<value_type> auto&& element)
+{
+    pushTail(std::forward<decltype(element)>(element));
+}
+
+template<typename T>
+template<typename... Args>
+auto VectorList<T>::emplaceHead(Args&&... args) -> reference
+    requires std::constructible_from<value_type, Args...>
+{
+    auto index = constructSlot(std::forward<Args>(args)...);
+    linkBefore(mLinks[sentinel].next, index);
+    return mValues[index];
+}
+
+template<typename T>
+template<typename... Args>
+auto VectorList<T>::emplaceTail(Args&&... args) -> reference
+    requires std::constructible_from<value_type, Args...>
+{
+    auto index = constructSlot(std::forward<Args>(args)...);
+    linkBefore(sentinel, index);
+    return mValues[index];
+}
+
+template<typename T>
+void VectorList<T>::insertBefore(const_iterator position, std::convertible_to<value_type> auto&& value)
+{
+    emplaceBefore(position, std::forward<decltype(value)>(value));
+}
+
+template<typename T>
+void VectorList<T>::insertAfter(const_iterator position, std::convertible_to<value_type> auto&& value)
+{
+    emplaceAfter(position, std::forward<decltype(value)>(value));
+}
+
+template<typename T>
+auto VectorList<T>::erase(const_iterator position) -> iterator
+{
+    position.validateIterator();
+    if (position == cend())
+    {
+        throw ListOutOfRangeException("Couldn't erase the end of the list");
+    }
+
+    auto next = mLinks[position.mIndex].next;
+    unlink(position.mIndex);
+    destroySlot(position.mIndex);
+    return iterator(this, next);
+}
+
+template<typename T>
+void VectorList<T>::insert(const_iterator position, std::convertible_to<value_type> auto&& value)
+{
+    insertBefore(position, std::forward<decltype(value)>(value));
+}
+
+template<typename T>
+template<typename... Args>
+auto VectorList<T>::emplaceBefore(const_iterator position, Args&&... args) -> iterator
+    requires std::constructible_from<value_type, Args...>
+{
+    position.validateIterator();
+
+    // Индексы переживают перераспределение хранилища
+    auto index = constructSlot(std::forward<Args>(args)...);
+    linkBefore(position.mIndex, index);
+    return iterator(this, index);
+}
+
+template<typename T>
+template<typename... Args>
+auto VectorList<T>::emplaceAfter(const_iterator position, Args&&... args) -> iterator
+    requires std::constructible_from<value_type, Args...>
+{
+    if (position == cend())
+    {
+        throw ListOutOfRangeException("Couldn't insert after the end of the list");
+    }
+
+    return emplaceBefore(++position, std::forward<Args>(args)...);
+}
+
+template<typename T>
+template<typename... Args>
+auto VectorList<T>::emplace(const_iterator position, Args&&... args) -> iterator
+    requires std::constructible_from<value_type, Args...>
+{
+    return emplaceBefore(position, std::forward<Args>(args)...);
+}
+
+template<typename T>
+auto VectorList<T>::operator+=(const VectorList& that) -> VectorList&
+{
+    this->append(that);
+    return *this;
+}
+
+template<typename T>
+auto VectorList<T>::operator+=(VectorList&& that) -> VectorList&
+{
+    this->append(std::move(that));
+    return *this;
+}
+
+template<typename T>
+void VectorList<T>::append(const VectorList& that)
+{
+    // Счётчик вместо итераторов: that может совпадать с *this
+    auto count = that.mLen;
+    reserve(mLen + count);
+    if constexpr (std::is_trivially_copyable_v<value_type>)
+    {
+        // После reserve: указатель на значения that мог измениться, если это *this
+        if (that.mOrdered && appendTrivially(that.mValues + 1, count))
+        {
+            return;
+        }
+    }
+    for (auto index = that.mLinks[sentinel].next; count > 0; index = that.mLinks[index].next, --count)
+    {
+        pushTail(that.mValues[index]);
+    }
+}
+
+// Хранилища разных списков не сшиваются, значения переносятся поэлементно
+template<typename T>
+void VectorList<T>::append(VectorList&& that)
+{
+    if (this == &that)
+    {
+        throw MovedSelfAppendException("Trying to concatenate moved list with itself");
+    }
+
+    if (empty())
+    {
+        *this = std::move(that);
+        return;
+    }
+
+    reserve(mLen + that.mLen);
+    while (auto element = that.popHead())
+    {
+        pushTail(std::move(*element));
+    }
+}
+
+template<typename T>
+template<std::ranges::input_range Rng>
+void VectorList<T>::append(const Rng& range)
+    requires std::convertible_to<typename Rng::value_type, value_type>
+{
+    append(std::ranges::begin(range), std::ranges::end(range));
+}
+
+template<typename T>
+template<std::input_iterator It>
+void VectorList<T>::append(It begin, It end)
+    requires std::convertible_to<typename std::iterator_traits<It>::value_type, value_type>
+{
+    if constexpr (std::contiguous_iterator<It> && std::is_same_v<std::iter_value_t<It>, value_type>
+                  && std::is_trivially_copyable_v<value_type>)
+    {
+        if (appendTrivially(std::to_address(begin), static_cast<size_type>(end - begin)))
+        {
+            return;
+        }
+    }
+    std::ranges::for_each(begin, end, [this](const value_type& element) { pushTail(element); });
+}
+
+template<typename T>
+void VectorList<T>::clear() noexcept
+{
+    auto allocator = Allocator();
+    for (auto index = mLinks[sentinel].next; index != sentinel; index = mLinks[index].next)
+    {
+        AllocTraits::destroy(allocator, mValues + index);
+    }
+    mLinks.resize(1);
+    resetLinks();
+}
+
+template<typename T>
+void VectorList<T>::swap(VectorList& other) noexcept
+{
+    std::swap(mLinks, other.mLinks);
+    std::swap(mValues, other.mValues);
+    std::swap(mCapacity, other.mCapacity);
+    std::swap(mFree, other.mFree);
+    std::swap(mOrdered, other.mOrdered);
+    std::swap(mLen, other.mLen);
+}
+
+template<typename T>
+void VectorList<T>::reserve(size_type count)
+{
+    if (count + 1 > mCapacity)
+    {
+        reallocate(count + 1);
+    }
+}
+
+template<typename T>
+void VectorList<T>::shrink_to_fit()
+{
+    auto compacted = VectorList();
+    compacted.reallocate(mLen + 1);
+    while (auto element = popHead())
+    {
+        compacted.pushTail(std::move(*element));
+    }
+    swap(compacted);
+}
+
+template<typename T>
+template<std::weakly_incrementable Out>
+auto VectorList<T>::copyTo(Out out) const -> Out
+    requires std::indirectly_writable<Out, const value_type&>
+{
+    if constexpr (std::contiguous_iterator<Out> && std::is_same_v<std::iter_value_t<Out>, value_type>
+                  && std::is_trivially_copyable_v<value_type>)
+    {
+        if (mOrdered)
+        {
+            if (mLen > 0)
+            {
+                std::memcpy(std::to_address(out), mValues + 1, mLen * sizeof(value_type));
+            }
+            return out + static_cast<std::iter_difference_t<Out>>(mLen);
+        }
+    }
+    return std::ranges::copy(*this, std::move(out)).out;
+}
+
+template<typename T>
+auto VectorList<T>::find(const value_type& value) -> iterator
+    requires std::equality_comparable<value_type>
+{
+    auto found = std::as_const(*this).find(value);
+    return iterator(this, found.mIndex);
+}
+
+template<typename T>
+auto VectorList<T>::find(const value_type& value) const -> const_iterator
+    requires std::equality_comparable<value_type>
+{
+    if constexpr (Vectorizable<value_type>)
+    {
+        if (mOrdered)
+        {
+            auto index = findValue(mValues + 1, mLen, value);
+            return const_iterator(this, index == mLen ? sentinel : static_cast<index_type>(index + 1));
+        }
+    }
+    return std::ranges::find(*this, value);
+}
+
+template<typename T>
+auto VectorList<T>::count(const value_type& value) const -> size_type
+    requires std::equality_comparable<value_type>
+{
+    if constexpr (Vectorizable<value_type>)
+    {
+        if (mOrdered)
+        {
+            return countValue(mValues + 1, mLen, value);
+        }
+    }
+    return static_cast<size_type>(std::ranges::count(*this, value));
+}
+
+template<typename T>
+auto VectorList<T>::min() const -> std::optional<value_type>
+    requires std::totally_ordered<value_type>
+{
+    if (empty())
+    {
+        return {};
+    }
+    if constexpr (Vectorizable<value_type>)
+    {
+        if (mOrdered)
+        {
+            return extremeValue(mValues + 1, mLen, std::less<value_type>());
+        }
+    }
+    return std::ranges::min(*this);
+}
+
+template<typename T>
+auto VectorList<T>::max() const -> std::optional<value_type>
+    requires std::totally_ordered<value_type>
+{
+    if (empty())
+    {
+        return {};
+    }
+    if constexpr (Vectorizable<value_type>)
+    {
+        if (mOrdered)
+        {
+            return extremeValue(mValues + 1, mLen, std::greater<value_type>());
+        }
+    }
+    return std::ranges::max(*this);
+}
+
+template<typename T>
+auto VectorList<T>::appendTrivially(const value_type* values, size_type count) -> bool
+{
+    if (!mOrdered)
+    {
+        return false;
+    }
+
+    // values может указывать в наше же хранилище, которое reserve перевыделит
+    auto owned = std::greater_equal<const value_type*>()(values, mValues)
+              && std::less<const value_type*>()(values, mValues + mCapacity);
+    auto offset = owned ? values - mValues : 0;
+    reserve(mLen + count);
+    if (owned)
+    {
+        values = mValues + offset;
+    }
+
+    // Свободные ячейки упорядоченного списка все лежат за mLen, их можно забыть
+    mLinks.resize(mLen + 1);
+    mFree = npos;
+    if (count == 0)
+    {
+        return true;
+    }
+
+    std::memcpy(mValues + mLen + 1, values, count * sizeof(value_type));
+    auto first = static_cast<index_type>(mLen + 1);
+    auto last = static_cast<index_type>(mLen + count);
+    for (auto index = first; index <= last; ++index)
+    {
+        mLinks.push_back({static_cast<index_type>(index - 1), static_cast<index_type>(index + 1)});
+    }
+    mLinks[last].next = sentinel;
+    mLinks[first].prev = mLinks[sentinel].prev;
+    mLinks[mLinks[sentinel].prev].next = first;
+    mLinks[sentinel].prev = last;
+    mLen += count;
+    return true;
+}
+
+template<typename T>
+void VectorList<T>::resetLinks()
+{
+    if (mLinks.empty())
+    {
+        mLinks.push_back({sentinel, sentinel});
+    }
+    mLinks[sentinel] = {sentinel, sentinel};
+    mFree = npos;
+    mOrdered = true;
+    mLen = 0;
+}
+
+// Перемещает живые значения в новое хранилище на те же индексы
+template<typename T>
+void VectorList<T>::reallocate(size_type capacity)
+{
+    if (capacity > npos)
+    {
+        throw std::length_error("VectorList capacity exceeds 32-bit index range");
+    }
+
+    auto allocator = Allocator();
+    auto values = allocator.allocate(capacity);
+    auto copied = false;
+    if constexpr (std::is_trivially_copyable_v<value_type>)
+    {
+        if (mOrdered && mLen > 0)
+        {
+            std::memcpy(values + 1, mValues + 1, mLen * sizeof(value_type));
+            copied = true;
+        }
+    }
+    if (!copied)
+    {
+        for (auto index = mLen ? mLinks[sentinel].next : sentinel; index != sentinel; index = mLinks[index].next)
+        {
+            AllocTraits::construct(allocator, values + index, std::move_if_noexcept(mValues[index]));
+            AllocTraits::destroy(allocator, mValues + index);
+        }
+    }
+
+    if (mValues)
+    {
+        allocator.deallocate(mValues, mCapacity);
+    }
+    mValues = values;
+    mCapacity = capacity;
+
+    mLinks.reserve(capacity);
+    if (mLinks.empty())
+    {
+        resetLinks();
+    }
+}
+
+template<typename T>
+void VectorList<T>::grow()
+{
+    reallocate(std::max(minCapacity, mCapacity * 2));
+}
+
+template<typename T>
+template<typename... Args>
+auto VectorList<T>::constructSlot(Args&&... args) -> index_type
+{
+    auto index = mFree;
+    if (index == npos && mLinks.size() >= mCapacity)
+    {
+        // Аргументы могут ссылаться на элементы самого списка
+        auto value = value_type(std::forward<Args>(args)...);
+        grow();
+        return constructSlot(std::move(value));
+    }
+
+    auto allocator = Allocator();
+    if (index != npos)
+    {
+        AllocTraits::construct(allocator, mValues + index, std::forward<Args>(args)...);
+        mFree = mLinks[index].next;
+    }
+    else
+    {
+        index = static_cast<index_type>(mLinks.size());
+        AllocTraits::construct(allocator, mValues + index, std::forward<Args>(args)...);
+        mLinks.push_back({npos, npos});
+    }
+    return index;
+}
+
+template<typename T>
+void VectorList<T>::linkBefore(index_type position, index_type index) noexcept
+{
+    auto prev = mLinks[position].prev;
+    mLinks[index] = {prev, position};
+    mLinks[prev].next = index;
+    mLinks[position].prev = index;
+    ++mLen;
+    mOrdered = mOrdered && position == sentinel && index == mLen;
+}
+
+template<typename T>
+void VectorList<T>::unlink(index_type index) noexcept
+{
+    auto [prev, next] = mLinks[index];
+    mLinks[prev].next = next;
+    mLinks[next].prev = prev;
+    mOrdered = mOrdered && index == mLen;
+    --mLen;
+}
+
+template<typename T>
+auto VectorList<T>::extract(index_type index) noexcept -> value_type
+{
+    auto data = std::move(mValues[index]);
+    unlink(index);
+    destroySlot(index);
+    return data;
+}
+
+template<typename T>
+void VectorList<T>::destroySlot(index_type index) noexcept
+{
+    auto allocator = Allocator();
+    AllocTraits::destroy(allocator, mValues + index);
+    mLinks[index] = {npos, mFree};
+    mFree = index;
+}
+
+template<typename T>
+auto operator+(const VectorList<T>& lhs, const VectorList<T>& rhs) -> VectorList<T>
+{
+    auto newList = VectorList<T>(lhs);
+    newList += rhs;
+    return newList;
+}
+
+template<typename T>
+auto operator<<(std::ostream& os, const VectorList<T>& ls) -> std::ostream&
+{
+    os << "[";
+    for (auto separator = ""; const auto& element : ls)
+    {
+        os << separator << element;
+        separator = ", ";
+    }
+    os << "]";
+    return os;
+}
+
+} // namespace mylist
@@ -1,4 +1,5 @@
 #include "mylist/list.hpp"
+#include <algorithm>
 #include <cctype>
 #include <fmt/ostream.h>
 #include <iostream>
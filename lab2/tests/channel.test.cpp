@@ -0,0 +1,147 @@
+#include "mylist/channel.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+auto produce(mylist::Channel<int>& channel, int count, std::vector<std::size_t>& sizes) -> mylist::Task
+{
+    for (int i = 0; i < count; ++i)
+    {
+        co_await channel.push(i);
+        sizes.push_back(channel.size());
+    }
+    channel.close();
+}
+
+auto consume(mylist::Channel<int>& channel, std::vector<int>& received) -> mylist::Task
+{
+    while (auto value = co_await channel.pop())
+    {
+        received.push_back(*value);
+    }
+}
+
+auto pushOnce(mylist::Channel<int>& channel, int value, bool& result) -> mylist::Task
+{
+    result = co_await channel.push(value);
+}
+
+auto throwing() -> mylist::Task
+{
+    throw std::runtime_error("task failed");
+    co_return;
+}
+
+} // namespace
+
+TEST_CASE("Channel producer and consumer")
+{
+    auto executor = mylist::Executor();
+    auto channel = mylist::Channel<int>(executor, 2);
+    auto sizes = std::vector<std::size_t>();
+    auto received = std::vector<int>();
+
+    SECTION("Consumer spawned first")
+    {
+        executor.spawn(consume(channel, received));
+        executor.spawn(produce(channel, 10, sizes));
+        executor.run();
+    }
+
+    SECTION("Producer spawned first")
+    {
+        executor.spawn(produce(channel, 10, sizes));
+        executor.spawn(consume(channel, received));
+        executor.run();
+    }
+
+    REQUIRE(executor.pending() == 0);
+    REQUIRE(received == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    REQUIRE(std::ranges::all_of(sizes, [&](std::size_t size) { return size <= channel.capacity(); }));
+    REQUIRE(channel.closed());
+    REQUIRE(channel.empty());
+}
+
+TEST_CASE("Channel backpressure")
+{
+    auto executor = mylist::Executor();
+    auto channel = mylist::Channel<int>(executor, 3);
+    auto sizes = std::vector<std::size_t>();
+
+    executor.spawn(produce(channel, 5, sizes));
+    executor.run();
+
+    REQUIRE(channel.full());
+    REQUIRE(sizes.size() == 3);
+    REQUIRE(executor.pending() == 1);
+
+    REQUIRE(channel.tryPop() == 0);
+    executor.run();
+    REQUIRE(sizes.size() == 4);
+    REQUIRE(channel.full());
+
+    REQUIRE_FALSE(channel.tryPush(100));
+    REQUIRE(channel.size() == 3);
+}
+
+TEST_CASE("Channel with zero capacity")
+{
+    auto executor = mylist::Executor();
+    auto channel = mylist::Channel<int>(executor, 0);
+    auto sizes = std::vector<std::size_t>();
+    auto received = std::vector<int>();
+
+    executor.spawn(produce(channel, 3, sizes));
+    executor.run();
+    REQUIRE(sizes.empty());
+
+    executor.spawn(consume(channel, received));
+    executor.run();
+
+    REQUIRE(received == std::vector<int>{0, 1, 2});
+    REQUIRE(sizes == std::vector<std::size_t>{0, 0, 0});
+    REQUIRE(executor.pending() == 0);
+}
+
+TEST_CASE("Channel close")
+{
+    auto executor = mylist::Executor();
+    auto channel = mylist::Channel<int>(executor, 1);
+
+    SECTION("Wakes suspended pusher")
+    {
+        auto first = false;
+        auto second = true;
+        executor.spawn(pushOnce(channel, 1, first));
+        executor.spawn(pushOnce(channel, 2, second));
+        executor.run();
+        REQUIRE(executor.pending() == 1);
+
+        channel.close();
+        executor.run();
+        REQUIRE(first);
+        REQUIRE_FALSE(second);
+        REQUIRE(executor.pending() == 0);
+    }
+
+    SECTION("Buffered values are drained after close")
+    {
+        REQUIRE(channel.tryPush(1));
+        channel.close();
+        REQUIRE_FALSE(channel.tryPush(2));
+        REQUIRE(channel.tryPop() == 1);
+        REQUIRE_FALSE(channel.tryPop().has_value());
+    }
+}
+
+TEST_CASE("Executor rethrows task exceptions")
+{
+    auto executor = mylist::Executor();
+    executor.spawn(throwing());
+    REQUIRE_THROWS_AS(executor.run(), std::runtime_error);
+    REQUIRE(executor.pending() == 0);
+}
@@ -0,0 +1,108 @@
+#include "mylist/compressed_list.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <vector>
+
+TEST_CASE("CompressedList push, pop and iteration")
+{
+    namespace rg = std::ranges;
+    static_assert(rg::bidirectional_range<mylist::CompressedList<int>>);
+    static_assert(std::bidirectional_iterator<mylist::CompressedList<int>::const_iterator>);
+
+    auto ls = mylist::CompressedList<int>{3, 4, 10};
+    ls.pushHead(-7);
+    ls.pushTail(1'000'000);
+    REQUIRE(rg::equal(ls, std::vector{-7, 3, 4, 10, 1'000'000}));
+    REQUIRE(std::equal(ls.crbegin(), ls.crend(), std::vector{1'000'000, 10, 4, 3, -7}.cbegin()));
+    REQUIRE(ls.peekHead() == -7);
+    REQUIRE(ls.peekTail() == 1'000'000);
+
+    REQUIRE(ls.popHead() == -7);
+    REQUIRE(ls.popTail() == 1'000'000);
+    REQUIRE(ls == mylist::CompressedList<int>{3, 4, 10});
+
+    auto out = std::ostringstream();
+    out << ls;
+    REQUIRE(out.str() == "[3, 4, 10]");
+
+    ls.clear();
+    REQUIRE(ls.empty());
+    REQUIRE_FALSE(ls.popTail().has_value());
+    REQUIRE_THROWS_AS(ls.peekHead(), mylist::ListOutOfRangeException);
+    REQUIRE_THROWS_AS(*ls.cbegin(), mylist::ListOutOfRangeException);
+}
+
+TEST_CASE("CompressedList extreme values")
+{
+    namespace rg = std::ranges;
+    using Limits = std::numeric_limits<std::int64_t>;
+    auto values = std::vector<std::int64_t>{Limits::min(), Limits::max(), 0, Limits::min(), -1, Limits::max()};
+    auto ls = mylist::CompressedList<std::int64_t>(values.begin(), values.end());
+    REQUIRE(rg::equal(ls, values));
+
+    auto bytes = mylist::CompressedList<std::uint8_t>{250, 3, 255, 0};
+    bytes.pushHead(std::uint8_t{128});
+    REQUIRE(rg::equal(bytes, std::vector<std::uint8_t>{128, 250, 3, 255, 0}));
+    REQUIRE(bytes.popTail() == 0);
+    REQUIRE(bytes.popTail() == 255);
+}
+
+TEST_CASE("CompressedList matches a deque under random operations")
+{
+    namespace rg = std::ranges;
+    auto random = std::mt19937(7);
+    auto ls = mylist::CompressedList<std::int32_t>();
+    auto expected = std::deque<std::int32_t>();
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        auto value = static_cast<std::int32_t>(random());
+        switch (random() % 4)
+        {
+        case 0:
+            ls.pushHead(value);
+            expected.push_front(value);
+            break;
+        case 1:
+            ls.pushTail(value);
+            expected.push_back(value);
+            break;
+        case 2:
+            REQUIRE(ls.popHead() == (expected.empty() ? std::nullopt : std::optional(expected.front())));
+            if (!expected.empty())
+            {
+                expected.pop_front();
+            }
+            break;
+        default:
+            ls.pushTail(value % 16);
+            expected.push_back(value % 16);
+            REQUIRE(ls.popTail() == expected.back());
+            expected.pop_back();
+            break;
+        }
+    }
+
+    REQUIRE(ls.size() == expected.size());
+    REQUIRE(rg::equal(ls, expected));
+    REQUIRE(std::equal(ls.crbegin(), ls.crend(), expected.crbegin(), expected.crend()));
+}
+
+TEST_CASE("CompressedList storage of increasing identifiers")
+{
+    auto ls = mylist::CompressedList<std::int64_t>();
+    for (std::int64_t id = 1'000'000'000; ls.size() < 10'000; id += 3)
+    {
+        ls.pushTail(id);
+    }
+
+    // Шаг 3 кодируется одним байтом
+    REQUIRE(ls.storageBytes() < ls.size() * 2);
+    REQUIRE(*std::prev(ls.cend()) == 1'000'000'000 + 3 * 9'999);
+}
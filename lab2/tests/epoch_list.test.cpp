@@ -0,0 +1,132 @@
+#include "mylist/epoch_list.hpp"
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+struct Tracked
+{
+    static inline int alive = 0;
+    int value;
+
+    Tracked(int value) : value(value)
+    {
+        ++alive;
+    }
+
+    Tracked(const Tracked& that) : value(that.value)
+    {
+        ++alive;
+    }
+
+    ~Tracked()
+    {
+        --alive;
+    }
+};
+
+} // namespace
+
+TEST_CASE("EpochList single-threaded operations")
+{
+    auto ls = mylist::EpochList<int>();
+    REQUIRE(ls.empty());
+    REQUIRE_FALSE(ls.popHead().has_value());
+    REQUIRE_FALSE(ls.popTail().has_value());
+
+    ls.pushTail(2);
+    ls.pushTail(3);
+    ls.pushHead(1);
+    REQUIRE(ls.size() == 3);
+    REQUIRE(std::ranges::equal(ls.read(), std::vector<int>{1, 2, 3}));
+
+    REQUIRE(ls.popHead() == 1);
+    REQUIRE(ls.popTail() == 3);
+    REQUIRE(std::ranges::equal(ls.read(), std::vector<int>{2}));
+
+    ls.clear();
+    REQUIRE(ls.empty());
+    REQUIRE(std::ranges::empty(ls.read()));
+
+    ls.pushTail(4);
+    REQUIRE(std::ranges::equal(ls.read(), std::vector<int>{4}));
+}
+
+TEST_CASE("EpochList defers reclamation while readers are pinned")
+{
+    {
+        auto ls = mylist::EpochList<Tracked>();
+        ls.pushTail(1);
+        ls.pushTail(2);
+        REQUIRE(Tracked::alive == 2);
+
+        {
+            auto view = ls.read();
+            auto it = view.begin();
+            ls.popHead();
+            ls.collect();
+            REQUIRE(ls.pendingReclamation() == 1);
+            REQUIRE(Tracked::alive == 2);
+            REQUIRE(it->value == 1);
+            REQUIRE((++it)->value == 2);
+        }
+
+        ls.collect();
+        REQUIRE(ls.pendingReclamation() == 0);
+        REQUIRE(Tracked::alive == 1);
+
+        {
+            auto view = ls.read();
+            ls.clear();
+        }
+        REQUIRE(Tracked::alive == 1);
+        ls.collect();
+        REQUIRE(Tracked::alive == 0);
+    }
+    REQUIRE(Tracked::alive == 0);
+}
+
+TEST_CASE("EpochList concurrent readers and one writer")
+{
+    auto ls = mylist::EpochList<int>();
+    auto stop = std::atomic<bool>(false);
+    auto failures = std::atomic<int>(0);
+
+    auto readers = std::vector<std::thread>();
+    for (int i = 0; i < 4; ++i)
+    {
+        readers.emplace_back([&] {
+            while (!stop.load())
+            {
+                auto view = ls.read();
+                if (!std::ranges::is_sorted(view))
+                {
+                    ++failures;
+                }
+            }
+        });
+    }
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        ls.pushTail(i);
+        if (ls.size() > 64)
+        {
+            ls.popHead();
+        }
+    }
+    stop.store(true);
+
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    REQUIRE(failures.load() == 0);
+    REQUIRE(ls.size() == 64);
+    REQUIRE(*ls.read().begin() == 20000 - 64);
+}
@@ -0,0 +1,193 @@
+#include "mylist/intrusive_list.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+
+struct Item
+{
+    int value;
+    mylist::ListHook hook{};
+    mylist::ListHook otherHook{};
+
+    Item(int value) : value(value) {}
+
+    friend auto operator<<(std::ostream& os, const Item& item) -> std::ostream&
+    {
+        return os << item.value;
+    }
+};
+
+using ItemList = mylist::IntrusiveList<Item, &Item::hook>;
+using OtherItemList = mylist::IntrusiveList<Item, &Item::otherHook>;
+
+auto values(const auto& ls) -> std::vector<int>
+{
+    auto result = std::vector<int>();
+    for (const auto& item : ls)
+    {
+        result.push_back(item.value);
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("IntrusiveList push, pop and peek")
+{
+    static_assert(std::ranges::bidirectional_range<ItemList>);
+    static_assert(std::bidirectional_iterator<ItemList::iterator>);
+    static_assert(std::bidirectional_iterator<ItemList::const_iterator>);
+
+    auto items = std::vector<Item>{1, 2, 3};
+    auto ls = ItemList();
+
+    REQUIRE(ls.empty());
+    REQUIRE(ls.popHead() == nullptr);
+    REQUIRE_THROWS_AS(ls.peekHead(), mylist::ListOutOfRangeException);
+
+    ls.pushTail(items[1]);
+    ls.pushTail(items[2]);
+    ls.pushHead(items[0]);
+
+    REQUIRE(ls.size() == 3);
+    REQUIRE(values(ls) == std::vector<int>{1, 2, 3});
+    REQUIRE(ls.peekHead().value == 1);
+    REQUIRE(ls.peekTail().value == 3);
+    auto reversed = std::vector<int>{3, 2, 1};
+    REQUIRE(std::ranges::equal(ls.crbegin(), ls.crend(), reversed.begin(), reversed.end(), {}, &Item::value));
+
+    REQUIRE(ls.popHead() == &items[0]);
+    REQUIRE(ls.popTail() == &items[2]);
+    REQUIRE(ls.size() == 1);
+    REQUIRE_FALSE(items[0].hook.linked());
+    REQUIRE(items[1].hook.linked());
+}
+
+TEST_CASE("IntrusiveList insert and erase")
+{
+    auto items = std::vector<Item>{1, 2, 3, 4};
+    auto ls = ItemList(items.begin(), items.begin() + 2);
+    auto extra = Item(100);
+
+    SECTION("insertBefore and insertAfter")
+    {
+        auto it = ls.insertBefore(std::next(ls.cbegin()), extra);
+        REQUIRE(it->value == 100);
+        REQUIRE(values(ls) == std::vector<int>{1, 100, 2});
+
+        ls.insertAfter(ls.cbegin(), items[3]);
+        REQUIRE(values(ls) == std::vector<int>{1, 4, 100, 2});
+        REQUIRE_THROWS_AS(ls.insertAfter(ls.cend(), items[2]), mylist::ListOutOfRangeException);
+    }
+
+    SECTION("erase by iterator")
+    {
+        auto next = ls.erase(ls.cbegin());
+        REQUIRE(next->value == 2);
+        REQUIRE(values(ls) == std::vector<int>{2});
+        REQUIRE_THROWS_AS(ls.erase(ls.cend()), mylist::ListOutOfRangeException);
+    }
+
+    SECTION("unlink from the element itself")
+    {
+        auto it = ls.iteratorTo(items[0]);
+        items[0].hook.unlink();
+        REQUIRE(ls.size() == 1);
+        REQUIRE(values(ls) == std::vector<int>{2});
+        REQUIRE(it.dangling());
+        REQUIRE_THROWS_AS(*it, mylist::DanglingIteratorException);
+    }
+
+    SECTION("element destruction unlinks it")
+    {
+        {
+            auto temp = Item(5);
+            ls.pushTail(temp);
+            REQUIRE(ls.size() == 3);
+        }
+        REQUIRE(ls.size() == 2);
+        REQUIRE(values(ls) == std::vector<int>{1, 2});
+    }
+
+    SECTION("pushing a linked element moves it")
+    {
+        ls.pushTail(items[0]);
+        REQUIRE(values(ls) == std::vector<int>{2, 1});
+        REQUIRE(ls.size() == 2);
+
+        auto other = ItemList();
+        other.pushTail(items[1]);
+        REQUIRE(values(ls) == std::vector<int>{1});
+        REQUIRE(other.contains(items[1]));
+        REQUIRE_FALSE(ls.contains(items[1]));
+    }
+}
+
+TEST_CASE("IntrusiveList element in two lists")
+{
+    auto items = std::vector<Item>{1, 2, 3};
+    auto first = ItemList(items.begin(), items.end());
+    auto second = OtherItemList(items.rbegin(), items.rend());
+
+    REQUIRE(values(first) == std::vector<int>{1, 2, 3});
+    REQUIRE(values(second) == std::vector<int>{3, 2, 1});
+
+    first.erase(items[1]);
+    REQUIRE(values(first) == std::vector<int>{1, 3});
+    REQUIRE(values(second) == std::vector<int>{3, 2, 1});
+}
+
+TEST_CASE("IntrusiveList move, append, swap and clear")
+{
+    auto items = std::vector<Item>{1, 2, 3, 4};
+    auto odds = ItemList();
+    auto evens = ItemList();
+    odds.pushTail(items[0]);
+    odds.pushTail(items[2]);
+    evens.pushTail(items[1]);
+    evens.pushTail(items[3]);
+
+    SECTION("Move")
+    {
+        auto moved = ItemList(std::move(odds));
+        REQUIRE(odds.empty());
+        REQUIRE(values(moved) == std::vector<int>{1, 3});
+        items[0].hook.unlink();
+        REQUIRE(moved.size() == 1);
+    }
+
+    SECTION("Append")
+    {
+        odds += std::move(evens);
+        REQUIRE(evens.empty());
+        REQUIRE(values(odds) == std::vector<int>{1, 3, 2, 4});
+        REQUIRE(odds.contains(items[3]));
+        REQUIRE_THROWS_AS(odds.append(std::move(odds)), mylist::MovedSelfAppendException);
+    }
+
+    SECTION("Swap")
+    {
+        odds.swap(evens);
+        REQUIRE(values(odds) == std::vector<int>{2, 4});
+        REQUIRE(values(evens) == std::vector<int>{1, 3});
+    }
+
+    SECTION("Clear")
+    {
+        odds.clear();
+        REQUIRE(odds.empty());
+        REQUIRE_FALSE(items[0].hook.linked());
+        REQUIRE(items[1].hook.linked());
+    }
+
+    SECTION("Print")
+    {
+        auto os = std::ostringstream();
+        os << odds;
+        REQUIRE(os.str() == "[1, 3]");
+    }
+}
@@ -1,7 +1,18 @@
 #include "mylist/list.hpp"
 #include <algorithm>
+#include <atomic>
 #include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <memory>
+#include <memory_resource>
+#include <new>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -320,6 +331,1053 @@ TEST_CASE("List pop methods")
     }
 }
 
+TEST_CASE("List batched pop methods")
+{
+    auto ls = mylist::List<int>{1, 2, 3, 4, 5};
+    auto out = std::vector<int>();
+
+    SECTION("popHeadN part of the list")
+    {
+        ls.popHeadN(2, std::back_inserter(out));
+        REQUIRE(out == std::vector<int>{1, 2});
+        REQUIRE(ls.size() == 3);
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{3, 4, 5}));
+        REQUIRE(ls.peekHead() == 3);
+        REQUIRE(*std::ranges::prev(ls.end()) == 5);
+    }
+
+    SECTION("popHeadN more than size")
+    {
+        ls.popHeadN(10, std::back_inserter(out));
+        REQUIRE(out == std::vector<int>{1, 2, 3, 4, 5});
+        REQUIRE(ls.empty());
+        REQUIRE(ls.begin() == ls.end());
+        ls.pushTail(6);
+        REQUIRE(ls.peekHead() == 6);
+    }
+
+    SECTION("popTailN part of the list")
+    {
+        ls.popTailN(2, std::back_inserter(out));
+        REQUIRE(out == std::vector<int>{5, 4});
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{1, 2, 3}));
+        REQUIRE(ls.peekTail() == 3);
+        ls.pushTail(7);
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{1, 2, 3, 7}));
+    }
+
+    SECTION("popTailN whole list")
+    {
+        ls.popTailN(5, std::back_inserter(out));
+        REQUIRE(out == std::vector<int>{5, 4, 3, 2, 1});
+        REQUIRE(ls.empty());
+    }
+
+    SECTION("popHeadN invalidates only detached iterators")
+    {
+        auto first = ls.begin();
+        auto third = std::ranges::next(ls.begin(), 2);
+        ls.popHeadN(2, std::back_inserter(out));
+        REQUIRE(first.dangling());
+        REQUIRE_FALSE(third.dangling());
+        REQUIRE(third == ls.begin());
+    }
+
+    SECTION("drainTo")
+    {
+        out.push_back(0);
+        REQUIRE(ls.drainTo(out) == 5);
+        REQUIRE(out == std::vector<int>{0, 1, 2, 3, 4, 5});
+        REQUIRE(ls.empty());
+        REQUIRE(ls.drainTo(out) == 0);
+    }
+}
+
+TEST_CASE("List compaction")
+{
+    namespace rg = std::ranges;
+
+    auto ls = mylist::List<long>{-1};
+    for (long i = 0; i < 100; ++i)
+    {
+        ls.insertBefore(rg::next(ls.cbegin(), ls.size() / 2), i);
+    }
+    auto expected = std::vector<long>(ls.begin(), ls.end());
+    REQUIRE(ls.fragmentation() > 0.5);
+
+    SECTION("compact keeps values and lays nodes out in traversal order")
+    {
+        auto it = ls.begin();
+        ls.compact();
+
+        REQUIRE(rg::equal(ls, expected));
+        REQUIRE(ls.size() == expected.size());
+        REQUIRE(ls.fragmentation() < 1e-9);
+        REQUIRE(it.dangling());
+
+        auto stride = reinterpret_cast<std::intptr_t>(&*rg::next(ls.begin()))
+                    - reinterpret_cast<std::intptr_t>(&*ls.begin());
+        REQUIRE(stride > 0);
+        for (auto prev = ls.begin(), cur = rg::next(prev); cur != ls.end(); ++prev, ++cur)
+        {
+            REQUIRE(reinterpret_cast<std::intptr_t>(&*cur) - reinterpret_cast<std::intptr_t>(&*prev) == stride);
+        }
+    }
+
+    SECTION("compacted list stays usable")
+    {
+        ls.compact();
+        ls.pushTail(1000);
+        ls.pushHead(-1);
+        ls.popTail();
+        ls.popHead();
+        ls.insertAfter(ls.cbegin(), 5);
+        REQUIRE(ls.size() == expected.size() + 1);
+        ls.clear();
+        REQUIRE(ls.empty());
+    }
+
+    SECTION("automatic compaction")
+    {
+        ls.compact();
+        ls.setCompactionThreshold(0.2);
+        for (long i = 0; i < 24; ++i)
+        {
+            ls.pushHead(i);
+        }
+        REQUIRE(ls.fragmentation() > 0.19);
+
+        auto it = ls.begin();
+        ls.pushHead(100);
+        ls.pushHead(101);
+        REQUIRE(it.dangling());
+        REQUIRE(ls.fragmentation() < 0.1);
+        REQUIRE(ls.peekHead() == 101);
+        REQUIRE(ls.size() == expected.size() + 26);
+    }
+}
+
+TEST_CASE("List prefetching traversal")
+{
+    auto ls = mylist::List<int>{1, 2, 3, 4, 5};
+    REQUIRE(ls.prefetchDistance() > 0);
+
+    for (auto distance : {0, 1, 2, 4, 16})
+    {
+        ls.setPrefetchDistance(distance);
+        auto visited = std::vector<int>();
+        ls.forEach([&](int element) { visited.push_back(element); });
+        REQUIRE(visited == std::vector<int>{1, 2, 3, 4, 5});
+    }
+
+    SECTION("forEach can modify values")
+    {
+        ls.forEach([](int& element) { element *= 10; });
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{10, 20, 30, 40, 50}));
+    }
+
+    SECTION("const forEach passes const values")
+    {
+        const auto& view = ls;
+        auto sum = 0;
+        view.forEach([&](auto& element) {
+            static_assert(std::is_const_v<std::remove_reference_t<decltype(element)>>);
+            sum += element;
+        });
+        REQUIRE(sum == 15);
+    }
+
+    SECTION("copies keep the distance")
+    {
+        ls.setPrefetchDistance(7);
+        auto copy = ls;
+        REQUIRE(copy.prefetchDistance() == 7);
+        REQUIRE(std::ranges::equal(copy, ls));
+    }
+
+    SECTION("self append")
+    {
+        ls.append(ls);
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{1, 2, 3, 4, 5, 1, 2, 3, 4, 5}));
+    }
+
+    SECTION("empty list")
+    {
+        auto empty = mylist::List<int>();
+        auto calls = 0;
+        empty.forEach([&](int) { ++calls; });
+        REQUIRE(calls == 0);
+    }
+}
+
+TEST_CASE("List in-place algorithms")
+{
+    auto ls = mylist::List<int>{1, 2, 2, 3, 4, 4, 4, 5};
+
+    SECTION("erase")
+    {
+        auto it = ls.erase(std::next(ls.cbegin()));
+        REQUIRE(*it == 2);
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{1, 2, 3, 4, 4, 4, 5}));
+
+        it = ls.erase(ls.cbegin());
+        REQUIRE(*it == 2);
+        REQUIRE(ls.peekHead() == 2);
+
+        it = ls.erase(std::prev(ls.cend()));
+        REQUIRE(it == ls.end());
+        REQUIRE(ls.peekTail() == 4);
+        REQUIRE(ls.size() == 5);
+        REQUIRE_THROWS_AS(ls.erase(ls.cend()), mylist::ListOutOfRangeException);
+
+        auto single = mylist::List<int>{1};
+        single.erase(single.cbegin());
+        REQUIRE(single.empty());
+        single.pushTail(2);
+        REQUIRE(std::ranges::equal(single, std::vector<int>{2}));
+    }
+
+    SECTION("splice")
+    {
+        ls.splice(ls.cbegin(), ls, std::prev(ls.cend()));
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{5, 1, 2, 2, 3, 4, 4, 4}));
+        REQUIRE(ls.peekTail() == 4);
+
+        auto moved = std::next(ls.begin(), 3);
+        ls.splice(ls.cend(), ls, moved);
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{5, 1, 2, 3, 4, 4, 4, 2}));
+        REQUIRE(*moved == 2);
+
+        ls.splice(moved, ls, moved);
+        ls.splice(std::next(moved), ls, moved);
+        REQUIRE(ls.size() == 8);
+        REQUIRE(ls.peekTail() == 2);
+
+        auto other = mylist::List<int>{10};
+        other.splice(other.cbegin(), ls, ls.cbegin());
+        REQUIRE(std::ranges::equal(other, std::vector<int>{5, 10}));
+        REQUIRE(ls.size() == 7);
+        REQUIRE(ls.peekHead() == 1);
+
+        auto empty = mylist::List<int>();
+        empty.splice(empty.cend(), other, std::next(other.cbegin()));
+        empty.splice(empty.cend(), other, other.cbegin());
+        REQUIRE(std::ranges::equal(empty, std::vector<int>{10, 5}));
+        REQUIRE(other.empty());
+        REQUIRE_THROWS_AS(ls.splice(ls.cbegin(), empty, empty.cend()), mylist::ListOutOfRangeException);
+    }
+
+    SECTION("merge")
+    {
+        auto other = mylist::List<int>{0, 2, 4, 6};
+        ls.merge(other);
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{0, 1, 2, 2, 2, 3, 4, 4, 4, 4, 5, 6}));
+        REQUIRE(ls.size() == 12);
+        REQUIRE(ls.peekTail() == 6);
+        REQUIRE(other.empty());
+        other.pushTail(7);
+        REQUIRE(std::ranges::equal(other, std::vector<int>{7}));
+
+        ls.merge(other);
+        ls.merge(other);
+        ls.merge(ls);
+        REQUIRE(ls.size() == 13);
+        REQUIRE(ls.peekTail() == 7);
+
+        auto empty = mylist::List<int>{1};
+        empty.popHead();
+        auto single = mylist::List<int>{3, 8};
+        empty.merge(single);
+        REQUIRE(std::ranges::equal(empty, std::vector<int>{3, 8}));
+        REQUIRE(std::ranges::equal(empty | std::views::reverse, std::vector<int>{8, 3}));
+
+        // Устойчивость: при равных ключах элементы *this идут первыми
+        using Pair = std::pair<int, char>;
+        auto byKey = [](const Pair& lhs, const Pair& rhs) { return lhs.first > rhs.first; };
+        auto lhs = mylist::List<Pair>{{3, 'a'}, {2, 'a'}, {1, 'a'}};
+        auto rhs = mylist::List<Pair>{{3, 'b'}, {1, 'b'}};
+        lhs.merge(rhs, byKey);
+        REQUIRE(std::ranges::equal(lhs, std::vector<Pair>{{3, 'a'}, {3, 'b'}, {2, 'a'}, {1, 'a'}, {1, 'b'}}));
+    }
+
+    SECTION("removeIf and erase_if")
+    {
+        auto kept = std::next(ls.begin(), 4);
+        auto removedIt = ls.begin();
+        REQUIRE(ls.removeIf([](int element) { return element % 2 == 1; }) == 3);
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{2, 2, 4, 4, 4}));
+        REQUIRE(ls.size() == 5);
+        REQUIRE(ls.peekTail() == 4);
+        REQUIRE(*kept == 4);
+        REQUIRE(removedIt.dangling());
+
+        REQUIRE(erase_if(ls, [](int element) { return element > 0; }) == 5);
+        REQUIRE(ls.empty());
+        ls.pushTail(7);
+        REQUIRE(ls.peekHead() == 7);
+    }
+
+    SECTION("unique")
+    {
+        REQUIRE(ls.unique() == 3);
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{1, 2, 3, 4, 5}));
+
+        REQUIRE(ls.unique([](int lhs, int rhs) { return rhs == lhs + 1; }) == 2);
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{1, 3, 5}));
+        REQUIRE(ls.peekTail() == 5);
+    }
+
+    SECTION("reverse")
+    {
+        ls.reverse();
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{5, 4, 4, 4, 3, 2, 2, 1}));
+        auto backwards = std::vector<int>{1, 2, 2, 3, 4, 4, 4, 5};
+        REQUIRE(std::equal(ls.crbegin(), ls.crend(), backwards.begin(), backwards.end()));
+        REQUIRE(ls.peekTail() == 1);
+        ls.pushTail(0);
+        REQUIRE(ls.peekTail() == 0);
+    }
+
+    SECTION("partition")
+    {
+        auto boundary = ls.partition([](int element) { return element % 2 == 0; });
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{2, 2, 4, 4, 4, 1, 3, 5}));
+        REQUIRE(*boundary == 1);
+        REQUIRE(ls.peekTail() == 5);
+        REQUIRE(ls.size() == 8);
+
+        REQUIRE(ls.partition([](int) { return true; }) == ls.end());
+        REQUIRE(ls.partition([](int) { return false; }) == ls.begin());
+
+        auto calls = 0;
+        REQUIRE_THROWS(ls.partition([&](int) {
+            if (++calls == 4)
+            {
+                throw std::runtime_error("pred");
+            }
+            return calls % 2 == 0;
+        }));
+        REQUIRE(ls.size() == 8);
+        auto sorted = std::vector<int>(ls.begin(), ls.end());
+        std::ranges::sort(sorted);
+        REQUIRE(sorted == std::vector<int>{1, 2, 2, 3, 4, 4, 4, 5});
+    }
+
+    SECTION("rotate")
+    {
+        auto oldHead = ls.rotate(std::next(ls.cbegin(), 3));
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{3, 4, 4, 4, 5, 1, 2, 2}));
+        REQUIRE(*oldHead == 1);
+        REQUIRE(ls.peekTail() == 2);
+        REQUIRE(*std::prev(ls.end()) == 2);
+
+        REQUIRE(ls.rotate(ls.cbegin()) == ls.begin());
+        REQUIRE(ls.rotate(ls.cend()) == ls.begin());
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{3, 4, 4, 4, 5, 1, 2, 2}));
+    }
+}
+
+namespace
+{
+
+// Ресурс, считающий выделения, освобождения и занятые байты
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    std::size_t allocations{};
+    std::size_t deallocations{};
+    std::size_t bytesInUse{};
+    std::size_t allocationLimit{std::numeric_limits<std::size_t>::max()};
+
+private:
+    auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override
+    {
+        if (allocations == allocationLimit)
+        {
+            throw std::bad_alloc();
+        }
+        ++allocations;
+        bytesInUse += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override
+    {
+        ++deallocations;
+        bytesInUse -= bytes;
+        std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+
+    auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override
+    {
+        return this == &other;
+    }
+};
+
+} // namespace
+
+TEST_CASE("pmr List")
+{
+    auto resource = CountingResource();
+
+    SECTION("nodes come from the resource")
+    {
+        {
+            auto ls = mylist::pmr::List<int>({1, 2, 3}, &resource);
+            REQUIRE(ls.get_allocator().resource() == &resource);
+            REQUIRE(resource.allocations == 4);
+
+            ls.pushHead(0);
+            ls.erase(std::next(ls.cbegin()));
+            REQUIRE(std::ranges::equal(ls, std::vector<int>{0, 2, 3}));
+            REQUIRE(resource.deallocations == 1);
+
+            ls.compact();
+            REQUIRE(std::ranges::equal(ls, std::vector<int>{0, 2, 3}));
+            REQUIRE(resource.allocations == 9);
+        }
+        REQUIRE(resource.allocations == resource.deallocations);
+    }
+
+    SECTION("copies and moves")
+    {
+        auto ls = mylist::pmr::List<int>({1, 2}, &resource);
+
+        auto moved = std::move(ls);
+        REQUIRE(moved.get_allocator().resource() == &resource);
+
+        auto copy = moved;
+        REQUIRE(copy.get_allocator().resource() == std::pmr::get_default_resource());
+
+        auto assigned = mylist::pmr::List<int>(&resource);
+        assigned = copy;
+        REQUIRE(assigned.get_allocator().resource() == &resource);
+        REQUIRE(std::ranges::equal(assigned, std::vector<int>{1, 2}));
+        REQUIRE(resource.allocations == 6);
+
+        // Узлы освобождаются своим ресурсом, в каком бы списке они ни оказались
+        copy.swap(assigned);
+        copy.splice(copy.cbegin(), moved, moved.cbegin());
+        REQUIRE(std::ranges::equal(copy, std::vector<int>{1, 1, 2}));
+    }
+
+    SECTION("failed compact keeps the values")
+    {
+        auto values = std::vector<std::string>();
+        for (int i = 0; i < 6; ++i)
+        {
+            values.push_back(std::string(40, static_cast<char>('a' + i)));
+        }
+        {
+            auto ls = mylist::pmr::List<std::string>(&resource);
+            for (const auto& value : values)
+            {
+                ls.pushTail(value);
+            }
+            resource.allocationLimit = resource.allocations + 3;
+            REQUIRE_THROWS_AS(ls.compact(), std::bad_alloc);
+            REQUIRE(std::ranges::equal(ls, values));
+
+            resource.allocationLimit = std::numeric_limits<std::size_t>::max();
+            ls.compact();
+            REQUIRE(std::ranges::equal(ls, values));
+        }
+        REQUIRE(resource.allocations == resource.deallocations);
+    }
+
+    SECTION("abandon in a monotonic arena")
+    {
+        auto arena = std::pmr::monotonic_buffer_resource(&resource);
+        auto ls = mylist::pmr::List<int>(&arena);
+        for (int i = 0; i < 1000; ++i)
+        {
+            ls.pushTail(i);
+        }
+
+        ls.abandon();
+        REQUIRE(ls.empty());
+        ls.pushTail(1);
+        REQUIRE(ls.peekHead() == 1);
+        ls.clear();
+
+        arena.release();
+        REQUIRE(resource.allocations == resource.deallocations);
+    }
+}
+
+TEST_CASE("List reserve")
+{
+    auto resource = CountingResource();
+
+    SECTION("churn within the reserve doesn't allocate")
+    {
+        {
+            auto ls = mylist::pmr::List<int>(&resource);
+            ls.reserve(100);
+            REQUIRE(ls.capacity() == 100);
+            REQUIRE(resource.allocations == 101);
+
+            for (int round = 0; round < 10; ++round)
+            {
+                for (int i = 0; i < 100; ++i)
+                {
+                    ls.pushTail(i);
+                }
+                REQUIRE(ls.capacity() == 100);
+                for (int i = 0; i < 50; ++i)
+                {
+                    REQUIRE(ls.popHead() == i);
+                    REQUIRE(ls.popTail() == 99 - i);
+                }
+                REQUIRE(ls.empty());
+                REQUIRE(ls.capacity() == 100);
+            }
+            REQUIRE(resource.allocations == 101);
+            REQUIRE(resource.deallocations == 0);
+
+            ls.emplaceHead(1);
+            ls.insertAfter(ls.cbegin(), 2);
+            ls.clear();
+            REQUIRE(resource.allocations == 101);
+
+            ls.shrink_to_fit();
+            REQUIRE(ls.capacity() == 0);
+            REQUIRE(resource.deallocations == 101);
+        }
+        REQUIRE(resource.allocations == resource.deallocations);
+    }
+
+    SECTION("batched removals refill the reserve")
+    {
+        auto ls = mylist::pmr::List<int>(&resource);
+        ls.reserve(8);
+        auto allocations = resource.allocations;
+        auto fill = [&] {
+            for (int i = 0; i < 8; ++i)
+            {
+                ls.pushTail(i);
+            }
+        };
+        auto drained = std::vector<int>();
+
+        fill();
+        REQUIRE(ls.drainTo(drained) == 8);
+        REQUIRE(ls.capacity() == 8);
+
+        fill();
+        ls.popHeadN(3, std::back_inserter(drained));
+        ls.popTailN(3, std::back_inserter(drained));
+        REQUIRE(ls.capacity() == 8);
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{3, 4}));
+
+        ls.erase(ls.cbegin());
+        REQUIRE(ls.erase(ls.cbegin()) == ls.end());
+        REQUIRE(ls.empty());
+        REQUIRE(ls.capacity() == 8);
+
+        fill();
+        REQUIRE(ls.removeIf([](int value) { return value % 2 == 0; }) == 4);
+        ls.pushHead(1);
+        REQUIRE(ls.unique() == 1);
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{1, 3, 5, 7}));
+        REQUIRE(ls.capacity() == 8);
+
+        REQUIRE(resource.allocations == allocations);
+        REQUIRE(resource.deallocations == 0);
+    }
+
+    SECTION("capacity past the reserve is freed")
+    {
+        auto ls = mylist::pmr::List<int>({1, 2, 3}, &resource);
+        ls.reserve(4);
+        REQUIRE(ls.capacity() == 4);
+        ls.pushTail(4);
+        ls.pushTail(5);
+        REQUIRE(ls.capacity() == 5);
+        REQUIRE(resource.allocations == 6);
+
+        ls.popTail();
+        REQUIRE(resource.deallocations == 1);
+        ls.clear();
+        REQUIRE(ls.capacity() == 4);
+        REQUIRE(resource.deallocations == 1);
+
+        ls.shrink_to_fit();
+        REQUIRE(ls.capacity() == 0);
+        REQUIRE(resource.allocations == resource.deallocations);
+    }
+
+    SECTION("recycled nodes drop their values")
+    {
+        auto value = std::make_shared<int>(1);
+        auto ls = mylist::List<std::shared_ptr<int>>();
+        ls.reserve(2);
+        ls.pushTail(value);
+        ls.pushTail(value);
+        REQUIRE(value.use_count() == 3);
+        ls.clear();
+        REQUIRE(value.use_count() == 1);
+        REQUIRE(ls.capacity() == 2);
+    }
+
+    SECTION("moving append into an empty list keeps its reserve and settings")
+    {
+        auto reclaimer = mylist::Reclaimer(4);
+        auto ls = mylist::List<int>();
+        ls.reserve(100);
+        ls.setReclaimer(&reclaimer);
+        ls.setPrefetchDistance(7);
+        auto other = mylist::List<int>{1, 2};
+
+        ls.append(std::move(other));
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{1, 2}));
+        REQUIRE(ls.capacity() >= 100);
+        REQUIRE(ls.reclaimer() == &reclaimer);
+        REQUIRE(ls.prefetchDistance() == 7);
+        REQUIRE(other.empty());
+
+        ls.popHead();
+        ls.append(mylist::List<int>{3});
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{2, 3}));
+        ls.clear();
+        ls.append(mylist::List<int>{4});
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{4}));
+        REQUIRE(ls.capacity() >= 100);
+        ls.setReclaimer(nullptr);
+    }
+
+    SECTION("iterators to removed elements dangle after reuse")
+    {
+        auto ls = mylist::List<int>();
+        ls.reserve(4);
+        ls.pushTail(1);
+        ls.pushTail(2);
+        auto it = ls.begin();
+        auto end = ls.cend();
+        ls.popHead();
+        REQUIRE(it.dangling());
+        REQUIRE_THROWS_AS(++it, mylist::DanglingIteratorException);
+        REQUIRE_FALSE(it.tryNext());
+
+        ls.pushTail(99);
+        REQUIRE(it.dangling());
+        REQUIRE(it.tryGet() == nullptr);
+        REQUIRE_THROWS_AS(*it, mylist::DanglingIteratorException);
+        REQUIRE(it != ls.begin());
+        REQUIRE(it != std::next(ls.begin()));
+        REQUIRE_FALSE(end.dangling());
+
+        ls.clear();
+        REQUIRE(end.dangling());
+        ls.pushTail(3);
+        REQUIRE(end.dangling());
+        REQUIRE(end != ls.cend());
+        REQUIRE(ls.capacity() == 4);
+    }
+
+    SECTION("the reserve moves with the list")
+    {
+        auto ls = mylist::pmr::List<int>(&resource);
+        ls.reserve(8);
+        auto moved = std::move(ls);
+        REQUIRE(moved.capacity() == 8);
+        REQUIRE(ls.capacity() == 0);
+
+        auto copy = moved;
+        REQUIRE(copy.capacity() == 0);
+
+        moved = mylist::pmr::List<int>({1, 2}, &resource);
+        REQUIRE(moved.capacity() == 2);
+        moved.reserve(8);
+        moved.compact();
+        REQUIRE(moved.capacity() == 8);
+        REQUIRE(std::ranges::equal(moved, std::vector<int>{1, 2}));
+    }
+}
+
+namespace
+{
+
+// Распределитель с состоянием: занятые байты в общем счётчике
+template<typename T>
+class CountingAllocator
+{
+    template<typename U>
+    friend class CountingAllocator;
+
+public:
+    using value_type = T;
+
+    explicit CountingAllocator(std::size_t* bytesInUse) noexcept : mBytesInUse(bytesInUse) {}
+
+    template<typename U>
+    CountingAllocator(const CountingAllocator<U>& that) noexcept : mBytesInUse(that.mBytesInUse)
+    {
+    }
+
+    auto allocate(std::size_t count) -> T*
+    {
+        *mBytesInUse += count * sizeof(T);
+        return std::allocator<T>().allocate(count);
+    }
+
+    void deallocate(T* pointer, std::size_t count) noexcept
+    {
+        *mBytesInUse -= count * sizeof(T);
+        std::allocator<T>().deallocate(pointer, count);
+    }
+
+    friend auto operator==(const CountingAllocator&, const CountingAllocator&) noexcept -> bool = default;
+
+private:
+    std::size_t* mBytesInUse;
+};
+
+} // namespace
+
+TEST_CASE("List memory_usage")
+{
+    SECTION("matches the bytes taken from a memory resource")
+    {
+        auto resource = CountingResource();
+        auto ls = mylist::pmr::List<int>(&resource);
+        auto matches = [&] { return ls.memory_usage().total() == sizeof(ls) + resource.bytesInUse; };
+        REQUIRE(ls.memory_usage() == mylist::MemoryUsage{0, sizeof(ls), 0});
+
+        for (int i = 0; i < 100; ++i)
+        {
+            ls.pushTail(i);
+        }
+        REQUIRE(matches());
+        REQUIRE(ls.memory_usage().payload == 100 * sizeof(int));
+        REQUIRE(ls.memory_usage().nodes == 101 * sizeof(mylist::Node<int>) - 100 * sizeof(int));
+
+        ls.popHead();
+        ls.popTail();
+        ls.erase(std::next(ls.cbegin()));
+        REQUIRE(matches());
+
+        ls.reserve(200);
+        REQUIRE(matches());
+        REQUIRE(ls.memory_usage().payload == 97 * sizeof(int));
+
+        ls.compact();
+        REQUIRE(matches());
+
+        ls.clear();
+        REQUIRE(matches());
+        REQUIRE(ls.memory_usage().payload == 0);
+
+        ls.shrink_to_fit();
+        ls.pushTail(1);
+        ls.popHead(); // терминатор остаётся в списке
+        REQUIRE(resource.bytesInUse > 0);
+        REQUIRE(matches());
+
+        ls.clear();
+        REQUIRE(resource.bytesInUse == 0);
+        REQUIRE(matches());
+    }
+
+    SECTION("matches the bytes taken from a stateful allocator")
+    {
+        auto bytesInUse = std::size_t{};
+        using Allocator = CountingAllocator<std::string>;
+        auto ls = mylist::List<std::string, Allocator>(Allocator(&bytesInUse));
+        ls.append(std::vector<std::string>{"a", "b", "c"});
+        ls.splice(ls.cbegin(), ls, std::prev(ls.cend()));
+        REQUIRE(ls.memory_usage().total() == sizeof(ls) + bytesInUse);
+        REQUIRE(ls.memory_usage().payload == 3 * sizeof(std::string));
+
+        auto other = mylist::List<std::string, Allocator>(Allocator(&bytesInUse));
+        other.pushTail("d");
+        REQUIRE((ls.memory_usage() + other.memory_usage()).total() == sizeof(ls) + sizeof(other) + bytesInUse);
+    }
+
+    SECTION("node cache and compaction pools")
+    {
+        auto ls = mylist::List<int>();
+        REQUIRE(ls.memory_usage().total() == sizeof(ls));
+        for (int i = 0; i < 100; ++i)
+        {
+            ls.pushHead(i);
+        }
+        auto cached = ls.memory_usage();
+        REQUIRE(cached.payload == 100 * sizeof(int));
+
+        // Блок узла из пула хранит ещё и копию PoolAllocator
+        ls.compact();
+        auto pooled = ls.memory_usage();
+        REQUIRE(pooled.nodes == cached.nodes);
+        REQUIRE(pooled.payload == cached.payload);
+        REQUIRE(pooled.control > cached.control);
+
+        // Освобождённые блоки пула остаются за списком, пока жив их кусок
+        ls.popTail();
+        REQUIRE(ls.memory_usage().control > pooled.control - 100);
+        REQUIRE(ls.memory_usage().payload == 99 * sizeof(int));
+
+        ls.clear();
+        REQUIRE(ls.memory_usage().total() == sizeof(ls));
+    }
+}
+
+TEST_CASE("List node cache")
+{
+    SECTION("freed nodes are reused by the same thread")
+    {
+        auto ls = mylist::List<int>{1, 2};
+        auto address = &ls.peekTail();
+        ls.popTail();
+        ls.pushTail(3);
+        REQUIRE(&ls.peekTail() == address);
+    }
+
+    SECTION("excess blocks go to the depot and back")
+    {
+        struct Payload
+        {
+            char bytes[200];
+        };
+        using Cache = mylist::BlockCache<sizeof(Payload), alignof(Payload)>;
+        auto allocator = mylist::CachingAllocator<Payload>();
+
+        std::thread([&] {
+            auto blocks = std::vector<Payload*>();
+            for (std::size_t i = 0; i < Cache::localLimit * 2; ++i)
+            {
+                blocks.push_back(allocator.allocate(1));
+            }
+            for (auto block : blocks)
+            {
+                allocator.deallocate(block, 1);
+            }
+            REQUIRE(Cache::localBlocks() <= Cache::localLimit);
+        }).join();
+
+        auto batches = Cache::depotBatches();
+        REQUIRE(batches >= 2);
+        auto block = allocator.allocate(1);
+        REQUIRE(Cache::depotBatches() == batches - 1);
+        REQUIRE(Cache::localBlocks() == Cache::batchSize - 1);
+        allocator.deallocate(block, 1);
+    }
+
+    SECTION("lists are built and destroyed on different threads")
+    {
+        auto lists = std::vector<mylist::List<int>>(4);
+        auto threads = std::vector<std::thread>();
+        for (std::size_t i = 0; i < lists.size(); ++i)
+        {
+            threads.emplace_back([&ls = lists[i], i] {
+                for (int j = 0; j < 1000; ++j)
+                {
+                    ls.pushTail(static_cast<int>(i) * 1000 + j);
+                    if (j % 3 == 0)
+                    {
+                        ls.popHead();
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        REQUIRE(lists[2].size() == 666);
+        REQUIRE(lists[2].peekTail() == 2999);
+        lists.clear();
+    }
+}
+
+TEST_CASE("List parallel construction")
+{
+    auto source = std::vector<std::string>();
+    for (int i = 0; i < 20'000; ++i)
+    {
+        source.push_back(std::to_string(i));
+    }
+
+    SECTION("from a random access range")
+    {
+        auto ls = mylist::List<std::string>(mylist::Parallel{4}, source.begin(), source.end());
+        REQUIRE(ls.size() == source.size());
+        REQUIRE(std::ranges::equal(ls, source));
+        REQUIRE(std::equal(ls.crbegin(), ls.crend(), source.rbegin(), source.rend()));
+        REQUIRE(ls.peekTail() == "19999");
+    }
+
+    SECTION("copy and append")
+    {
+        auto ls = mylist::List<std::string>(source.begin(), source.end());
+        auto copy = mylist::List<std::string>(mylist::Parallel{3}, ls);
+        REQUIRE(std::ranges::equal(copy, source));
+
+        copy.append(mylist::parallel, copy);
+        REQUIRE(copy.size() == 2 * source.size());
+        REQUIRE(std::ranges::equal(std::views::drop(copy, source.size()), source));
+        copy.pushTail("tail");
+        REQUIRE(copy.peekTail() == "tail");
+    }
+
+    SECTION("short sources are copied serially")
+    {
+        auto small = std::vector<std::string>{"a", "b"};
+        auto ls = mylist::List<std::string>(mylist::Parallel{8}, small.begin(), small.end());
+        REQUIRE(std::ranges::equal(ls, small));
+
+        auto empty = std::vector<std::string>();
+        REQUIRE(mylist::List<std::string>(mylist::parallel, empty.begin(), empty.end()).empty());
+    }
+
+    SECTION("exceptions from workers are rethrown")
+    {
+        struct Throwing
+        {
+            int value;
+
+            Throwing(int value = 0) : value(value)
+            {
+                if (value == 15'000)
+                {
+                    throw std::runtime_error("construction");
+                }
+            }
+        };
+
+        auto ints = std::vector<int>(20'000);
+        std::iota(ints.begin(), ints.end(), 0);
+        REQUIRE_THROWS_AS(mylist::List<Throwing>(mylist::Parallel{4}, ints.begin(), ints.end()), std::runtime_error);
+    }
+}
+
+TEST_CASE("List deferred reclamation")
+{
+    // Считает разрушения значений не на потоке, который их создал
+    struct Tracked
+    {
+        std::atomic<int>* offThread{};
+        std::thread::id owner;
+
+        ~Tracked()
+        {
+            if (offThread && std::this_thread::get_id() != owner)
+            {
+                ++*offThread;
+            }
+        }
+    };
+
+    auto offThread = std::atomic<int>();
+    auto fill = [&](mylist::List<Tracked>& ls) {
+        for (int i = 0; i < 100; ++i)
+        {
+            ls.pushTail(Tracked{&offThread, std::this_thread::get_id()});
+        }
+    };
+
+    SECTION("pops and clear go to the reclaimer thread")
+    {
+        auto reclaimer = mylist::Reclaimer(16);
+        auto ls = mylist::List<Tracked>();
+        ls.setReclaimer(&reclaimer);
+        fill(ls);
+
+        REQUIRE(ls.popHead().has_value());
+        REQUIRE(ls.popTail().has_value());
+        REQUIRE(std::distance(ls.crbegin(), ls.crend()) == 98);
+        auto copy = ls;
+        REQUIRE(copy.reclaimer() == &reclaimer);
+        ls.clear();
+        reclaimer.drain();
+
+        REQUIRE(offThread == 100);
+        REQUIRE(reclaimer.deferred() == 3);
+        REQUIRE(reclaimer.reclaimedInline() == 0);
+        REQUIRE(copy.size() == 98);
+        copy.setReclaimer(nullptr);
+    }
+
+    SECTION("batched removals go to the reclaimer thread")
+    {
+        auto reclaimer = mylist::Reclaimer(16);
+        auto ls = mylist::List<Tracked>();
+        ls.setReclaimer(&reclaimer);
+        fill(ls);
+
+        auto index = 0;
+        REQUIRE(ls.removeIf([&](const Tracked&) { return index++ % 2 == 0; }) == 50);
+        REQUIRE(ls.unique([](const Tracked&, const Tracked&) { return true; }) == 49);
+        auto drained = std::vector<Tracked>();
+        REQUIRE(ls.drainTo(drained) == 1);
+        reclaimer.drain();
+
+        // Каждая операция отдаёт свою цепочку одним вызовом
+        REQUIRE(offThread == 100);
+        REQUIRE(reclaimer.deferred() == 3);
+        REQUIRE(reclaimer.reclaimedInline() == 0);
+    }
+
+    SECTION("compacted nodes freed from both threads")
+    {
+        // Со стандартным распределителем compact() переносит узлы в пул,
+        // а освобождают их и поток списка, и поток освобождения
+        auto reclaimer = mylist::Reclaimer(4);
+        auto ls = mylist::List<int>();
+        ls.setReclaimer(&reclaimer);
+        for (int round = 0; round < 5; ++round)
+        {
+            for (int i = 0; i < 1000; ++i)
+            {
+                ls.pushTail(i);
+            }
+            ls.compact();
+            while (ls.size() > 1)
+            {
+                ls.popHead();
+                ls.erase(ls.cbegin());
+                if (ls.size() % 100 == 0)
+                {
+                    REQUIRE(ls.memory_usage().payload == ls.size() * sizeof(int));
+                }
+            }
+            ls.clear();
+        }
+        reclaimer.drain();
+        REQUIRE(reclaimer.deferred() > 0);
+        REQUIRE(ls.empty());
+    }
+
+    SECTION("a full queue falls back to inline reclamation")
+    {
+        auto reclaimer = mylist::Reclaimer(0);
+        auto ls = mylist::List<Tracked>();
+        ls.setReclaimer(&reclaimer);
+        fill(ls);
+        ls.popHead();
+        ls.clear();
+
+        REQUIRE(offThread == 0);
+        REQUIRE(reclaimer.deferred() == 0);
+        REQUIRE(reclaimer.reclaimedInline() == 2);
+    }
+
+    SECTION("the reclaimer drains its queue on destruction")
+    {
+        {
+            auto reclaimer = mylist::Reclaimer();
+            for (int i = 0; i < 10; ++i)
+            {
+                auto ls = mylist::List<Tracked>();
+                ls.setReclaimer(&reclaimer);
+                fill(ls);
+            }
+        }
+        REQUIRE(offThread == 1000);
+    }
+}
+
 TEST_CASE("List clear method")
 {
     auto ls = mylist::List<int>{1, 2, 3, 4, 5};
@@ -481,6 +1539,143 @@ TEST_CASE("List iterators")
     }
 }
 
+TEST_CASE("List non-throwing API")
+{
+    auto ls = mylist::List<int>{1, 2, 3};
+    static_assert(noexcept(ls.tryPeekHead()));
+    static_assert(noexcept(ls.tryInsertAfter(ls.cbegin(), 1)));
+    static_assert(noexcept(ls.tryEmplaceAfter(ls.cbegin(), 1)));
+    static_assert(noexcept(ls.cbegin().tryNext()));
+
+    SECTION("peek")
+    {
+        REQUIRE(*ls.tryPeekHead() == 1);
+        REQUIRE(*std::as_const(ls).tryPeekTail() == 3);
+        *ls.tryPeekTail() = 4;
+        REQUIRE(ls.peekTail() == 4);
+
+        auto empty = mylist::List<std::string>();
+        REQUIRE(empty.tryPeekHead() == nullptr);
+        REQUIRE(std::as_const(empty).tryPeekTail() == nullptr);
+        empty.pushTail("a");
+        empty.popHead();
+        REQUIRE(empty.tryPeekTail() == nullptr);
+    }
+
+    SECTION("insert and emplace")
+    {
+        REQUIRE(ls.tryInsertAfter(ls.cbegin(), 10) == mylist::Status::ok);
+        REQUIRE(ls.tryInsertBefore(ls.cend(), 20) == mylist::Status::ok);
+        auto it = ls.tryEmplaceAfter(std::prev(ls.cend()), 30);
+        REQUIRE(it);
+        REQUIRE(**it == 30);
+        REQUIRE(std::ranges::equal(ls, std::vector<int>{1, 10, 2, 3, 20, 30}));
+        REQUIRE(ls.peekTail() == 30);
+
+        REQUIRE(ls.tryInsertAfter(ls.cend(), 0) == mylist::Status::outOfRange);
+        REQUIRE(ls.tryEmplaceAfter(ls.cend(), 0).status() == mylist::Status::outOfRange);
+        REQUIRE(ls.tryEmplaceBefore(mylist::List<int>::const_iterator(), 0).status()
+                == mylist::Status::danglingIterator);
+        REQUIRE(ls.size() == 6);
+
+        // Опустошённый popHead список сохраняет свой end()
+        auto single = mylist::List<int>{1};
+        single.popHead();
+        auto end = single.cend();
+        auto first = single.tryEmplaceBefore(end, 5);
+        REQUIRE(first);
+        REQUIRE(**first == 5);
+        REQUIRE(end == single.cend());
+        REQUIRE(std::ranges::equal(single, std::vector<int>{5}));
+    }
+
+    SECTION("auto-compaction")
+    {
+        auto rotated = mylist::List<int>();
+        for (int i = 0; i < 100; ++i)
+        {
+            rotated.pushTail(i);
+        }
+        rotated.setCompactionThreshold(0.01);
+        rotated.rotate(std::next(rotated.cbegin(), 50));
+
+        auto before = rotated.tryEmplaceBefore(std::next(rotated.cbegin()), -1);
+        REQUIRE(before);
+        REQUIRE_FALSE(before->dangling());
+        REQUIRE(**before == -1);
+
+        auto after = rotated.tryEmplaceAfter(rotated.cbegin(), -2);
+        REQUIRE(after);
+        REQUIRE_FALSE(after->dangling());
+        REQUIRE(**after == -2);
+
+        // Вставки со Status сжимают список, как insertAfter
+        REQUIRE(rotated.tryInsertAfter(rotated.cbegin(), -3) == mylist::Status::ok);
+        REQUIRE(rotated.fragmentation() < 0.01);
+        REQUIRE(std::ranges::equal(rotated | std::views::take(4), std::vector<int>{50, -3, -2, -1}));
+        REQUIRE(rotated.size() == 103);
+    }
+
+    SECTION("out of memory")
+    {
+        auto arena = std::pmr::monotonic_buffer_resource(std::pmr::null_memory_resource());
+        auto pmrList = mylist::pmr::List<int>(&arena);
+        REQUIRE(pmrList.tryInsertBefore(pmrList.cend(), 1) == mylist::Status::danglingIterator);
+        REQUIRE(pmrList.empty());
+
+        auto buffer = std::vector<std::byte>(4096);
+        auto bounded = std::pmr::monotonic_buffer_resource(buffer.data(), buffer.size(),
+                                                           std::pmr::null_memory_resource());
+        auto boundedList = mylist::pmr::List<int>({0}, &bounded);
+        auto status = mylist::Status::ok;
+        auto count = 1;
+        while (status == mylist::Status::ok)
+        {
+            status = boundedList.tryInsertAfter(std::prev(boundedList.cend()), count++);
+        }
+        REQUIRE(status == mylist::Status::outOfMemory);
+        REQUIRE(boundedList.size() == static_cast<std::size_t>(count - 1));
+        REQUIRE(boundedList.peekTail() == count - 2);
+
+        // Неудачное сжатие после вставки не отменяет её и не трогает значения
+        auto resource = CountingResource();
+        auto strings = mylist::pmr::List<std::string>(&resource);
+        for (int i = 0; i < 100; ++i)
+        {
+            strings.pushTail(std::string(40, 'x') + std::to_string(i));
+        }
+        strings.setCompactionThreshold(0.01);
+        strings.rotate(std::next(strings.cbegin(), 50));
+        auto expected = std::vector<std::string>(strings.begin(), strings.end());
+        expected.insert(std::next(expected.begin()), "inserted");
+
+        resource.allocationLimit = resource.allocations + 10;
+        REQUIRE(strings.tryInsertAfter(strings.cbegin(), std::string("inserted")) == mylist::Status::ok);
+        REQUIRE(std::ranges::equal(strings, expected));
+        REQUIRE(strings.fragmentation() >= 0.01);
+    }
+
+    SECTION("iterators")
+    {
+        auto it = ls.begin();
+        REQUIRE(*it.tryGet() == 1);
+        REQUIRE(it.tryNext());
+        REQUIRE(*it.tryGet() == 2);
+        REQUIRE(it.tryPrev());
+        REQUIRE(it == ls.begin());
+
+        auto dangling = mylist::List<int>::const_iterator();
+        {
+            auto temp = mylist::List<int>{1};
+            dangling = temp.cbegin();
+        }
+        REQUIRE(dangling.tryGet() == nullptr);
+        REQUIRE_FALSE(dangling.tryNext());
+        REQUIRE_FALSE(dangling.tryPrev());
+        REQUIRE(dangling.dangling());
+    }
+}
+
 TEST_CASE("ListBase")
 {
     auto ls = std::shared_ptr<mylist::List<int>>(new mylist::List<int>{1, 2, 3, 4, 5});
@@ -0,0 +1,132 @@
+#include "mylist/lru_cache.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+auto keys(const auto& cache) -> std::vector<int>
+{
+    auto result = std::vector<int>();
+    for (const auto& [key, value] : cache)
+    {
+        result.push_back(key);
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("LruCache get and put")
+{
+    auto cache = mylist::LruCache<int, std::string>(3);
+    REQUIRE(cache.empty());
+    REQUIRE(cache.capacity() == 3);
+    REQUIRE(cache.get(1) == nullptr);
+
+    REQUIRE_FALSE(cache.put(1, "one"));
+    REQUIRE_FALSE(cache.put(2, "two"));
+    REQUIRE_FALSE(cache.put(3, "three"));
+    REQUIRE(keys(cache) == std::vector<int>{3, 2, 1});
+
+    SECTION("get moves the entry to the front")
+    {
+        REQUIRE(*cache.get(1) == "one");
+        REQUIRE(keys(cache) == std::vector<int>{1, 3, 2});
+        REQUIRE(cache.hits() == 1);
+        REQUIRE(cache.misses() == 1);
+    }
+
+    SECTION("peek keeps the order")
+    {
+        REQUIRE(*cache.peek(1) == "one");
+        REQUIRE(cache.peek(4) == nullptr);
+        REQUIRE(keys(cache) == std::vector<int>{3, 2, 1});
+    }
+
+    SECTION("put evicts the least recently used entry")
+    {
+        cache.get(1);
+        auto evicted = cache.put(4, "four");
+        REQUIRE(evicted);
+        REQUIRE(evicted->first == 2);
+        REQUIRE(evicted->second == "two");
+        REQUIRE(keys(cache) == std::vector<int>{4, 1, 3});
+        REQUIRE_FALSE(cache.contains(2));
+        REQUIRE(cache.size() == 3);
+    }
+
+    SECTION("put updates an existing entry")
+    {
+        REQUIRE_FALSE(cache.put(1, "uno"));
+        REQUIRE(*cache.peek(1) == "uno");
+        REQUIRE(keys(cache) == std::vector<int>{1, 3, 2});
+        REQUIRE(cache.size() == 3);
+    }
+
+    SECTION("erase, evict and clear")
+    {
+        REQUIRE(cache.erase(2));
+        REQUIRE_FALSE(cache.erase(2));
+        REQUIRE(keys(cache) == std::vector<int>{3, 1});
+
+        REQUIRE(cache.evict()->first == 1);
+        REQUIRE(keys(cache) == std::vector<int>{3});
+
+        cache.clear();
+        REQUIRE(cache.empty());
+        REQUIRE_FALSE(cache.evict());
+        REQUIRE_FALSE(cache.put(5, "five"));
+        REQUIRE(keys(cache) == std::vector<int>{5});
+    }
+}
+
+TEST_CASE("LruCache with zero capacity")
+{
+    auto cache = mylist::LruCache<int, int>(0);
+    auto rejected = cache.put(1, 10);
+    REQUIRE(rejected);
+    REQUIRE(rejected->second == 10);
+    REQUIRE(cache.empty());
+    REQUIRE(cache.get(1) == nullptr);
+}
+
+TEST_CASE("LruCache with a single slot")
+{
+    auto cache = mylist::LruCache<int, int>(1);
+    cache.put(1, 10);
+    REQUIRE(*cache.get(1) == 10);
+    REQUIRE(cache.put(2, 20)->first == 1);
+    REQUIRE(*cache.get(2) == 20);
+    REQUIRE(keys(cache) == std::vector<int>{2});
+}
+
+TEST_CASE("LruCache keeps its entries when put throws")
+{
+    struct Picky
+    {
+        int value{};
+
+        Picky() = default;
+        Picky(int value) : value(value)
+        {
+            if (value < 0)
+            {
+                throw std::runtime_error("construction");
+            }
+        }
+    };
+
+    auto cache = mylist::LruCache<int, Picky>(2);
+    cache.put(1, 10);
+    cache.put(2, 20);
+    REQUIRE_THROWS_AS(cache.put(3, -1), std::runtime_error);
+    REQUIRE(keys(cache) == std::vector<int>{2, 1});
+    REQUIRE(cache.peek(1)->value == 10);
+    REQUIRE_FALSE(cache.contains(3));
+
+    REQUIRE(cache.put(3, 30)->first == 1);
+    REQUIRE(keys(cache) == std::vector<int>{3, 2});
+}
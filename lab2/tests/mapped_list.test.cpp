@@ -0,0 +1,179 @@
+#include "mylist/mapped_list.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <sstream>
+#include <system_error>
+#include <vector>
+
+namespace
+{
+
+struct Point
+{
+    std::int32_t x;
+    std::int32_t y;
+
+    friend auto operator==(const Point&, const Point&) -> bool = default;
+};
+
+// Временный файл, удаляемый в конце теста
+class TempFile
+{
+public:
+    TempFile(const char* name) : mPath(std::filesystem::temp_directory_path() / name)
+    {
+        std::filesystem::remove(mPath);
+    }
+
+    ~TempFile()
+    {
+        std::filesystem::remove(mPath);
+    }
+
+    auto path() const -> const std::filesystem::path&
+    {
+        return mPath;
+    }
+
+private:
+    std::filesystem::path mPath;
+};
+
+} // namespace
+
+TEST_CASE("MappedList operations")
+{
+    namespace rg = std::ranges;
+    static_assert(rg::bidirectional_range<mylist::MappedList<int>>);
+    static_assert(std::bidirectional_iterator<mylist::MappedList<int>::const_iterator>);
+
+    auto file = TempFile("mylist_mapped_operations.bin");
+    auto ls = mylist::MappedList<int>(file.path());
+    REQUIRE(ls.empty());
+    REQUIRE_FALSE(ls.popHead().has_value());
+    REQUIRE_THROWS_AS(ls.peekTail(), mylist::ListOutOfRangeException);
+
+    ls.pushTail(2);
+    ls.pushTail(3);
+    ls.pushHead(1);
+    auto it = ls.insertAfter(ls.cbegin(), 10);
+    REQUIRE(*it == 10);
+    REQUIRE(rg::equal(ls, std::vector{1, 10, 2, 3}));
+    REQUIRE(*ls.erase(it) == 2);
+    REQUIRE(ls.peekHead() == 1);
+    REQUIRE(ls.peekTail() == 3);
+    REQUIRE(ls.popTail() == 3);
+    REQUIRE_THROWS_AS(*it, mylist::DanglingIteratorException);
+    REQUIRE_THROWS_AS(ls.erase(ls.cend()), mylist::ListOutOfRangeException);
+
+    auto out = std::ostringstream();
+    out << ls;
+    REQUIRE(out.str() == "[1, 2]");
+    auto reversed = std::vector{2, 1};
+    REQUIRE(std::equal(ls.crbegin(), ls.crend(), reversed.cbegin(), reversed.cend()));
+
+    SECTION("growth keeps iterators valid")
+    {
+        auto head = ls.cbegin();
+        auto capacity = ls.capacity();
+        for (int i = 0; i < 1000; ++i)
+        {
+            ls.pushTail(i);
+        }
+        REQUIRE(ls.capacity() > capacity);
+        REQUIRE(*head == 1);
+        REQUIRE(ls.size() == 1002);
+        REQUIRE(ls.peekTail() == 999);
+    }
+
+    SECTION("values from the mapping survive growth")
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            ls.pushTail(ls.peekHead());
+            ls.insertAfter(ls.cbegin(), ls.peekTail());
+        }
+        REQUIRE(ls.size() == 2002);
+        REQUIRE(rg::count(ls, 1) == 2001);
+    }
+
+    SECTION("freed slots are reused")
+    {
+        ls.clear();
+        for (int i = 0; i < 100; ++i)
+        {
+            ls.pushTail(i);
+            ls.popHead();
+        }
+        REQUIRE(ls.empty());
+        REQUIRE(ls.capacity() == 63);
+    }
+}
+
+TEST_CASE("MappedList persistence")
+{
+    namespace rg = std::ranges;
+    auto file = TempFile("mylist_mapped_persistence.bin");
+    auto expected = std::vector<Point>();
+    {
+        auto ls = mylist::MappedList<Point>(file.path());
+        for (std::int32_t i = 0; i < 500; ++i)
+        {
+            ls.pushTail({i, -i});
+            expected.push_back({i, -i});
+        }
+        ls.erase(ls.cbegin());
+        ls.pushHead({7, 7});
+        expected.front() = {7, 7};
+        ls.flush();
+    }
+
+    auto reopened = mylist::MappedList<Point>(file.path());
+    REQUIRE(reopened.size() == expected.size());
+    REQUIRE(rg::equal(reopened, expected));
+
+    auto moved = std::move(reopened);
+    moved.popHead();
+    REQUIRE(moved.peekHead() == Point{1, -1});
+
+    SECTION("another value type is rejected")
+    {
+        REQUIRE_THROWS_AS(mylist::MappedList<std::int64_t>(file.path()), mylist::MappedListFormatException);
+    }
+}
+
+TEST_CASE("MappedList rejects foreign files")
+{
+    auto file = TempFile("mylist_mapped_foreign.bin");
+    {
+        auto os = std::ofstream(file.path(), std::ios::binary);
+        os << std::string(4096, 'x');
+    }
+    REQUIRE_THROWS_AS(mylist::MappedList<int>(file.path()), mylist::MappedListFormatException);
+
+    REQUIRE_THROWS_AS(mylist::MappedList<int>("/nonexistent/dir/list.bin"), std::system_error);
+}
+
+TEST_CASE("MappedList rejects a corrupted free list")
+{
+    auto file = TempFile("mylist_mapped_free.bin");
+    {
+        auto ls = mylist::MappedList<int>(file.path());
+        ls.pushTail(1);
+        ls.flush();
+    }
+
+    // Поле free заголовка: после сигнатуры, двух размеров, capacity и used
+    auto free = std::uint64_t{1000};
+    {
+        auto os = std::fstream(file.path(), std::ios::binary | std::ios::in | std::ios::out);
+        os.seekp(8 + 4 * sizeof(std::uint64_t));
+        os.write(reinterpret_cast<const char*>(&free), sizeof(free));
+    }
+    REQUIRE_THROWS_AS(mylist::MappedList<int>(file.path()), mylist::MappedListFormatException);
+}
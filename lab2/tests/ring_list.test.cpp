@@ -0,0 +1,156 @@
+#include "mylist/ring_list.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <iterator>
+#include <memory_resource>
+#include <sstream>
+#include <string>
+#include <vector>
+
+TEST_CASE("RingList overwriting the oldest")
+{
+    auto ring = mylist::RingList<int>(3);
+    REQUIRE(ring.empty());
+    REQUIRE(ring.capacity() == 3);
+    REQUIRE(ring.policy() == mylist::Overflow::overwriteOldest);
+
+    for (int i = 1; i <= 3; ++i)
+    {
+        REQUIRE(ring.pushTail(i));
+    }
+    REQUIRE(ring.full());
+    REQUIRE(ring.dropped() == 0);
+
+    SECTION("pushTail recycles the head")
+    {
+        auto newest = std::prev(ring.cend());
+        REQUIRE(ring.pushTail(4));
+        REQUIRE(ring.pushTail(5));
+        REQUIRE(ring.size() == 3);
+        REQUIRE(ring.dropped() == 2);
+        REQUIRE(std::ranges::equal(ring, std::vector<int>{3, 4, 5}));
+        REQUIRE(*newest == 3);
+    }
+
+    SECTION("iterators to overwritten elements dangle")
+    {
+        auto oldest = ring.cbegin();
+        auto newest = std::prev(ring.cend());
+        REQUIRE(ring.pushTail(4));
+        REQUIRE(oldest.dangling());
+        REQUIRE(oldest.tryGet() == nullptr);
+        REQUIRE_FALSE(newest.dangling());
+        REQUIRE(*newest == 3);
+    }
+
+    SECTION("pushHead recycles the tail")
+    {
+        REQUIRE(ring.pushHead(0));
+        REQUIRE(std::ranges::equal(ring, std::vector<int>{0, 1, 2}));
+        REQUIRE(ring.peekHead() == 0);
+        REQUIRE(ring.peekTail() == 2);
+    }
+
+    SECTION("popping frees room")
+    {
+        REQUIRE(ring.popHead() == 1);
+        REQUIRE_FALSE(ring.full());
+        REQUIRE(ring.pushTail(4));
+        REQUIRE(ring.dropped() == 0);
+        REQUIRE(std::ranges::equal(ring, std::vector<int>{2, 3, 4}));
+    }
+
+    SECTION("bidirectional iteration and output")
+    {
+        ring.pushTail(4);
+        auto reversed = std::vector<int>(ring.crbegin(), ring.crend());
+        REQUIRE(reversed == std::vector<int>{4, 3, 2});
+        for (auto& element : ring)
+        {
+            element *= 10;
+        }
+
+        auto os = std::ostringstream();
+        os << ring;
+        REQUIRE(os.str() == "[20, 30, 40]");
+    }
+
+    SECTION("back_inserter")
+    {
+        std::ranges::copy(std::vector<int>{7, 8}, std::back_inserter(ring));
+        REQUIRE(std::ranges::equal(ring, std::vector<int>{3, 7, 8}));
+    }
+}
+
+TEST_CASE("RingList rejecting new elements")
+{
+    auto ring = mylist::RingList<std::string>(2, mylist::Overflow::rejectNew);
+    REQUIRE(ring.pushTail("a"));
+    REQUIRE(ring.pushHead("b"));
+    REQUIRE_FALSE(ring.pushTail("c"));
+    REQUIRE_FALSE(ring.pushHead("d"));
+    REQUIRE(ring.dropped() == 2);
+    REQUIRE(std::ranges::equal(ring, std::vector<std::string>{"b", "a"}));
+
+    ring.clear();
+    REQUIRE(ring.pushTail("e"));
+    REQUIRE(ring.peekHead() == "e");
+}
+
+TEST_CASE("RingList without room")
+{
+    auto ring = mylist::RingList<int>(0);
+    REQUIRE(ring.full());
+    REQUIRE_FALSE(ring.pushTail(1));
+    REQUIRE_FALSE(ring.pushHead(2));
+    REQUIRE(ring.empty());
+    REQUIRE(ring.dropped() == 2);
+}
+
+TEST_CASE("RingList doesn't allocate once full")
+{
+    class CountingResource : public std::pmr::memory_resource
+    {
+    public:
+        std::size_t allocations{};
+        std::size_t bytesInUse{};
+
+    private:
+        auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override
+        {
+            ++allocations;
+            bytesInUse += bytes;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override
+        {
+            bytesInUse -= bytes;
+            std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+        }
+
+        auto do_is_equal(const std::pmr::memory_resource& other) const noexcept -> bool override
+        {
+            return this == &other;
+        }
+    };
+
+    auto resource = CountingResource();
+    auto ring = mylist::RingList<int, std::pmr::polymorphic_allocator<int>>(16, mylist::Overflow::overwriteOldest,
+                                                                            &resource);
+    for (int i = 0; i < 16; ++i)
+    {
+        ring.pushTail(i);
+    }
+    auto allocations = resource.allocations;
+    for (int i = 16; i < 1000; ++i)
+    {
+        ring.pushTail(i);
+    }
+    REQUIRE(resource.allocations == allocations);
+    REQUIRE(ring.peekHead() == 984);
+    REQUIRE(ring.peekTail() == 999);
+
+    REQUIRE(ring.memory_usage().total() == sizeof(ring) + resource.bytesInUse);
+    REQUIRE(ring.memory_usage().payload == 16 * sizeof(int));
+}
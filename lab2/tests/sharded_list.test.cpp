@@ -0,0 +1,160 @@
+#include "mylist/sharded_list.hpp"
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <numeric>
+#include <sstream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+constexpr auto threadCount = 4;
+constexpr auto perThread = 1000;
+
+// Значение кодирует поток и номер записи в нём
+void ingest(mylist::ShardedList<int>& ls)
+{
+    auto threads = std::vector<std::thread>();
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&ls, t] {
+            for (int i = 0; i < perThread; ++i)
+            {
+                ls.pushTail(t * perThread + i);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+// Записи каждого потока идут в порядке записи
+auto perThreadOrdered(const auto& range) -> bool
+{
+    auto last = std::vector<int>(threadCount, -1);
+    for (auto value : range)
+    {
+        auto& previous = last[value / perThread];
+        if (value <= previous)
+        {
+            return false;
+        }
+        previous = value;
+    }
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("ShardedList shards")
+{
+    auto ls = mylist::ShardedList<int>();
+    REQUIRE(ls.empty());
+    REQUIRE(ls.shardCount() == 0);
+
+    ls.pushTail(1);
+    ls.emplaceTail(2);
+    REQUIRE(&ls.local() == &ls.local());
+    REQUIRE(ls.shardCount() == 1);
+
+    auto other = mylist::ShardedList<int>();
+    other.pushTail(3);
+    REQUIRE(&other.local() != &ls.local());
+    REQUIRE(std::ranges::equal(ls.view(), std::vector<int>{1, 2}));
+
+    // Переключение между списками находит прежний шард, а не заводит новый
+    auto* mine = &ls.local();
+    other.pushTail(4);
+    ls.pushTail(5);
+    REQUIRE(&ls.local() == mine);
+    REQUIRE(ls.shardCount() == 1);
+    REQUIRE(other.shardCount() == 1);
+    ls.local().popTail();
+    other.local().popTail();
+
+    ingest(ls);
+    REQUIRE(ls.shardCount() == threadCount + 1);
+    REQUIRE(ls.size() == threadCount * perThread + 2);
+    REQUIRE(other.size() == 1);
+
+    auto sum = 0L;
+    ls.forEach([&](int value) { sum += value; });
+    auto viewed = std::vector<int>(ls.view().begin(), ls.view().end());
+    REQUIRE(viewed.size() == ls.size());
+    REQUIRE(std::accumulate(viewed.begin(), viewed.end(), 0L) == sum);
+
+    auto usage = ls.memory_usage();
+    REQUIRE(usage.payload == ls.size() * sizeof(int));
+    REQUIRE(usage.total() > sizeof(ls) + ls.shardCount() * sizeof(mylist::List<int>) + usage.payload);
+
+    ls.clear();
+    REQUIRE(ls.empty());
+    REQUIRE(ls.shardCount() == threadCount + 1);
+    REQUIRE(ls.memory_usage().payload == 0);
+}
+
+TEST_CASE("ShardedList collect")
+{
+    auto ls = mylist::ShardedList<int>();
+    ingest(ls);
+
+    SECTION("per-thread order")
+    {
+        auto before = ls.memory_usage();
+        auto merged = ls.collect();
+        REQUIRE(merged.size() == threadCount * perThread);
+        REQUIRE(merged.memory_usage().payload == before.payload);
+        REQUIRE(ls.memory_usage().payload == 0);
+        REQUIRE(perThreadOrdered(merged));
+        REQUIRE(ls.empty());
+
+        ls.pushTail(-1);
+        REQUIRE(ls.collect().peekHead() == -1);
+    }
+
+    SECTION("by key")
+    {
+        // Ключ — номер записи внутри потока, при равных ключах раньше первый шард
+        auto merged = ls.collect([](int value) { return value % perThread; });
+        REQUIRE(merged.size() == threadCount * perThread);
+        REQUIRE(std::ranges::is_sorted(merged, {}, [](int value) { return value % perThread; }));
+        REQUIRE(perThreadOrdered(merged));
+        REQUIRE(ls.empty());
+    }
+}
+
+TEST_CASE("ShardedList ordered by a global sequence")
+{
+    auto sequence = std::atomic<int>();
+    auto ls = mylist::ShardedList<std::pair<int, int>>();
+    auto threads = std::vector<std::thread>();
+    for (int t = 0; t < threadCount; ++t)
+    {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < perThread; ++i)
+            {
+                ls.emplaceTail(sequence.fetch_add(1), t);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    auto merged = ls.collect(&std::pair<int, int>::first);
+    auto expected = 0;
+    REQUIRE(std::ranges::all_of(merged, [&](const auto& event) { return event.first == expected++; }));
+
+    auto os = std::ostringstream();
+    auto small = mylist::ShardedList<int>();
+    small.pushTail(1);
+    small.pushTail(2);
+    os << small;
+    REQUIRE(os.str() == "[1, 2]");
+}
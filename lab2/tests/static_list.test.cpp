@@ -0,0 +1,161 @@
+#include "mylist/static_list.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr auto makePrimes()
+{
+    auto primes = mylist::StaticList<int, 10>();
+    for (int candidate = 2; !primes.full(); ++candidate)
+    {
+        if (std::ranges::none_of(primes, [&](int prime) { return candidate % prime == 0; }))
+        {
+            primes.pushTail(candidate);
+        }
+    }
+    return primes;
+}
+
+// Собирается при компиляции и хранится в статической памяти
+constexpr auto primes = makePrimes();
+
+constexpr auto sum(const auto& ls)
+{
+    auto total = 0;
+    for (auto element : ls)
+    {
+        total += element;
+    }
+    return total;
+}
+
+} // namespace
+
+TEST_CASE("StaticList in constant expressions")
+{
+    static_assert(std::ranges::bidirectional_range<mylist::StaticList<int, 4>>);
+    static_assert(std::bidirectional_iterator<mylist::StaticList<int, 4>::iterator>);
+    static_assert(std::bidirectional_iterator<mylist::StaticList<int, 4>::const_iterator>);
+
+    static_assert(primes.size() == 10);
+    static_assert(primes.peekHead() == 2);
+    static_assert(primes.peekTail() == 29);
+    static_assert(sum(primes) == 129);
+
+    static_assert([] {
+        auto ls = mylist::StaticList<int, 4>{1, 2, 3};
+        ls.popHead();
+        ls.pushHead(10);
+        ls.insertAfter(ls.cbegin(), 20);
+        ls.erase(std::prev(ls.cend()));
+        return ls == mylist::StaticList<int, 4>{10, 20, 2};
+    }());
+
+    REQUIRE(std::ranges::equal(primes, std::vector<int>{2, 3, 5, 7, 11, 13, 17, 19, 23, 29}));
+}
+
+TEST_CASE("StaticList at run time")
+{
+    auto ls = mylist::StaticList<std::string, 3>();
+    REQUIRE(ls.empty());
+    REQUIRE(ls.capacity() == 3);
+    REQUIRE_FALSE(ls.popHead());
+    REQUIRE_THROWS_AS(ls.peekHead(), mylist::ListOutOfRangeException);
+
+    ls.pushTail("b");
+    ls.pushHead("a");
+    ls.pushTail("c");
+    REQUIRE(ls.full());
+    REQUIRE_THROWS_AS(ls.pushTail("d"), mylist::ListOutOfRangeException);
+    REQUIRE(std::ranges::equal(ls, std::vector<std::string>{"a", "b", "c"}));
+
+    SECTION("freed slots are reused")
+    {
+        auto it = std::next(ls.cbegin());
+        REQUIRE(*ls.erase(it) == "c");
+        REQUIRE(it.dangling());
+        REQUIRE_THROWS_AS(*it, mylist::DanglingIteratorException);
+
+        auto inserted = ls.insertBefore(ls.cend(), "d");
+        REQUIRE(*inserted == "d");
+        REQUIRE(std::ranges::equal(ls, std::vector<std::string>{"a", "c", "d"}));
+        auto reversed = std::vector<std::string>{"d", "c", "a"};
+        REQUIRE(std::equal(ls.crbegin(), ls.crend(), reversed.begin(), reversed.end()));
+    }
+
+    SECTION("pop and clear")
+    {
+        REQUIRE(ls.popTail() == "c");
+        REQUIRE(ls.popHead() == "a");
+        REQUIRE(ls.size() == 1);
+
+        ls.clear();
+        REQUIRE(ls.empty());
+        ls.pushTail("e");
+        REQUIRE(ls.peekHead() == "e");
+    }
+
+    SECTION("iterators of another list are rejected")
+    {
+        auto other = mylist::StaticList<std::string, 3>{"x"};
+        REQUIRE_THROWS_AS(ls.erase(other.cbegin()), mylist::ListOutOfRangeException);
+        REQUIRE_THROWS_AS(ls.insertAfter(ls.cend(), "x"), mylist::ListOutOfRangeException);
+    }
+
+    SECTION("Print")
+    {
+        auto os = std::ostringstream();
+        os << ls;
+        REQUIRE(os.str() == "[a, b, c]");
+    }
+}
+
+TEST_CASE("StaticList keeps its state when assignment throws")
+{
+    struct Picky
+    {
+        long value{};
+
+        Picky() = default;
+        Picky(long value) : value(value) {}
+        Picky(const Picky&) = default;
+        Picky(Picky&&) = default;
+
+        auto operator=(const Picky& that) -> Picky&
+        {
+            if (that.value < 0)
+            {
+                throw std::runtime_error("assignment");
+            }
+            value = that.value;
+            return *this;
+        }
+
+        auto operator=(Picky&& that) -> Picky&
+        {
+            return *this = that;
+        }
+    };
+
+    auto ls = mylist::StaticList<Picky, 3>();
+    REQUIRE_THROWS_AS(ls.pushTail(Picky(-1)), std::runtime_error);
+    REQUIRE(ls.empty());
+
+    ls.pushTail(Picky(1));
+    ls.pushTail(Picky(2));
+    ls.erase(ls.cbegin());
+    REQUIRE_THROWS_AS(ls.pushHead(Picky(-1)), std::runtime_error);
+    REQUIRE(ls.size() == 1);
+
+    ls.pushHead(Picky(0));
+    ls.pushTail(Picky(3));
+    REQUIRE(ls.size() == 3);
+    REQUIRE(std::ranges::equal(ls, std::vector<long>{0, 2, 3}, {}, &Picky::value));
+}
@@ -0,0 +1,105 @@
+#include "mylist/string_list.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std::string_view_literals;
+
+TEST_CASE("StringList operations")
+{
+    namespace rg = std::ranges;
+    static_assert(rg::bidirectional_range<mylist::StringList>);
+
+    auto ls = mylist::StringList{"second", "third"};
+    ls.pushHead("first");
+    auto temporary = std::string("fourth");
+    ls.pushTail(temporary);
+    temporary.assign("changed");
+    REQUIRE(rg::equal(ls, std::vector{"first"sv, "second"sv, "third"sv, "fourth"sv}));
+
+    ls.insertAfter(ls.cbegin(), "one and a half");
+    auto next = ls.erase(std::next(ls.cbegin(), 2));
+    REQUIRE(*next == "third");
+    REQUIRE(ls.peekHead() == "first");
+    REQUIRE(ls.peekTail() == "fourth");
+
+    auto popped = ls.popTail();
+    REQUIRE(popped == "fourth");
+    REQUIRE(ls.size() == 3);
+
+    auto out = std::ostringstream();
+    out << ls;
+    REQUIRE(out.str() == "[first, one and a half, third]");
+
+    auto reversed = std::vector{"third"sv, "one and a half"sv, "first"sv};
+    REQUIRE(std::equal(ls.crbegin(), ls.crend(), reversed.cbegin(), reversed.cend()));
+
+    ls.clear();
+    REQUIRE(ls.empty());
+    REQUIRE_FALSE(ls.popHead().has_value());
+    REQUIRE_THROWS_AS(ls.peekTail(), mylist::ListOutOfRangeException);
+
+    // Извлечённое значение живо, пока жива арена
+    REQUIRE(*popped == "fourth");
+}
+
+TEST_CASE("StringList arena sharing and interning")
+{
+    namespace rg = std::ranges;
+    auto arena = std::make_shared<mylist::StringArena>(true);
+    auto lhs = mylist::StringList(arena);
+    auto rhs = mylist::StringList(arena);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        lhs.pushTail("repeated");
+        rhs.pushHead(i % 2 == 0 ? "even" : "odd");
+    }
+    REQUIRE(arena->usedBytes() == "repeated"sv.size() + "even"sv.size() + "odd"sv.size());
+    REQUIRE(lhs.peekHead().data() == lhs.peekTail().data());
+
+    SECTION("append from the same arena shares the bytes")
+    {
+        auto used = arena->usedBytes();
+        lhs.append(rhs);
+        REQUIRE(lhs.size() == 200);
+        REQUIRE(arena->usedBytes() == used);
+    }
+
+    SECTION("append from another arena copies the bytes")
+    {
+        auto other = mylist::StringList{"foreign"};
+        lhs += other;
+        other.clear();
+        REQUIRE(lhs.peekTail() == "foreign");
+        REQUIRE(arena->usedBytes() == 22);
+    }
+
+    SECTION("copies share the arena")
+    {
+        auto copy = lhs;
+        REQUIRE(copy == lhs);
+        REQUIRE(copy.peekHead().data() == lhs.peekHead().data());
+    }
+}
+
+TEST_CASE("StringArena blocks")
+{
+    auto arena = mylist::StringArena();
+    auto big = std::string(mylist::StringArena::blockSize, 'x');
+    auto small = arena.store("small");
+    auto stored = arena.store(big);
+    REQUIRE(stored == big);
+    REQUIRE(arena.store("").empty());
+
+    // Большая строка не занимает текущий блок
+    auto after = arena.store("after");
+    REQUIRE(after.data() == small.data() + small.size());
+    REQUIRE(arena.reservedBytes() == 2 * mylist::StringArena::blockSize);
+    REQUIRE(arena.usedBytes() == big.size() + 10);
+}
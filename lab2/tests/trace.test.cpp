@@ -0,0 +1,110 @@
+#include "latency.hpp"
+#include "mylist/list.hpp"
+#include "mylist/vector_list.hpp"
+#include "trace.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <sstream>
+#include <vector>
+
+namespace tools = mylist::tools;
+
+TEST_CASE("LatencyHistogram percentiles")
+{
+    auto histogram = tools::LatencyHistogram();
+    REQUIRE(histogram.percentile(0.99) == 0);
+
+    for (std::uint64_t i = 1; i <= 1000; ++i)
+    {
+        histogram.record(i);
+    }
+    histogram.record(1'000'000);
+
+    REQUIRE(histogram.count() == 1001);
+    REQUIRE(histogram.min() == 1);
+    REQUIRE(histogram.max() == 1'000'000);
+
+    // Погрешность корзин не больше 1/16
+    auto p50 = histogram.percentile(0.5);
+    REQUIRE(p50 >= 501);
+    REQUIRE(p50 <= 501 + 501 / 16);
+    REQUIRE(histogram.percentile(0.999) <= 1000 + 1000 / 16);
+    REQUIRE(histogram.percentile(1.0) == 1'000'000);
+
+    auto other = tools::LatencyHistogram();
+    other.record(5);
+    histogram.merge(other);
+    REQUIRE(histogram.count() == 1002);
+}
+
+TEST_CASE("LatencyHistogram JSON summary")
+{
+    auto histogram = tools::LatencyHistogram();
+    histogram.record(10);
+    histogram.record(10);
+    histogram.record(4);
+
+    auto out = std::ostringstream();
+    tools::writeJson(out, histogram);
+    REQUIRE(out.str()
+            == R"({"count": 3, "min": 4, "mean": 8, "p50": 10, "p99": 10, "p999": 10, "max": 10})");
+}
+
+TEST_CASE("Trace recording, serialization and replay")
+{
+    auto trace = tools::Trace();
+    auto ls = mylist::List<std::int64_t>();
+    auto recorder = tools::RecordingList(ls, trace);
+    auto appended = mylist::List<std::int64_t>{7, 8};
+
+    recorder.pushTail(1);
+    recorder.pushTail(-300);
+    recorder.pushHead(0);
+    recorder.insert(1, 5);
+    recorder.append(appended);
+    recorder.erase(2);
+    recorder.popTail();
+    recorder.iterate([](std::int64_t) {});
+    auto expected = std::vector<std::int64_t>(ls.begin(), ls.end());
+    REQUIRE(expected == std::vector<std::int64_t>{0, 5, -300, 7});
+    REQUIRE(trace.size() == 8);
+
+    auto buffer = std::stringstream();
+    trace.save(buffer);
+    REQUIRE(buffer.str().size() < tools::Trace::magic.size() + 3 * trace.size());
+
+    auto loaded = tools::Trace::load(buffer);
+    REQUIRE(loaded.size() == trace.size());
+    REQUIRE(loaded.records()[1].value == -300);
+    REQUIRE(loaded.records()[4].index == 2);
+
+    SECTION("replay on List")
+    {
+        auto replayed = mylist::List<std::int64_t>();
+        auto report = tools::replay(loaded, replayed);
+        // В трассе хранится только длина дописанного списка, значения заменяются на 0, 1, ...
+        REQUIRE(std::ranges::equal(replayed, std::vector<std::int64_t>{0, 5, -300, 0}));
+        REQUIRE(report.operations == 8);
+        REQUIRE(report.skipped == 0);
+        REQUIRE(report.overall().count() == 8);
+        REQUIRE(report.perOperation[static_cast<std::size_t>(tools::TraceOp::PushTail)].count() == 2);
+    }
+
+    SECTION("replay on VectorList")
+    {
+        auto replayed = mylist::VectorList<std::int64_t>();
+        auto report = tools::replay(loaded, replayed);
+        REQUIRE(report.skipped == 0);
+        REQUIRE(std::ranges::equal(replayed, std::vector<std::int64_t>{0, 5, -300, 0}));
+    }
+
+    SECTION("malformed input")
+    {
+        auto garbage = std::stringstream("not a trace");
+        REQUIRE_THROWS_AS(tools::Trace::load(garbage), tools::TraceFormatException);
+
+        auto truncated = std::stringstream(buffer.str().substr(0, tools::Trace::magic.size() + 1));
+        REQUIRE_THROWS_AS(tools::Trace::load(truncated), tools::TraceFormatException);
+    }
+}
@@ -0,0 +1,290 @@
+#include "mylist/vector_list.hpp"
+#include <algorithm>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+TEST_CASE("VectorList constructors and assignment operators")
+{
+    namespace rg = std::ranges;
+    auto vecToCopy = std::vector<int>{1, 2, 3, 4, 5};
+    auto lsToCopy = mylist::VectorList<int>{1, 2, 3, 4, 5};
+
+    static_assert(std::ranges::bidirectional_range<mylist::VectorList<int>>);
+    static_assert(std::bidirectional_iterator<mylist::VectorList<int>::iterator>);
+    static_assert(std::bidirectional_iterator<mylist::VectorList<int>::const_iterator>);
+
+    SECTION("Default")
+    {
+        auto ls = mylist::VectorList<int>();
+        REQUIRE(ls.empty());
+        REQUIRE(ls.begin() == ls.end());
+        REQUIRE_THROWS_AS(ls.peekHead(), mylist::ListOutOfRangeException);
+    }
+
+    SECTION("Range and fill")
+    {
+        REQUIRE(rg::equal(mylist::VectorList<int>(vecToCopy), vecToCopy));
+        REQUIRE(rg::equal(mylist::VectorList<int>(3, 7), std::vector<int>{7, 7, 7}));
+    }
+
+    SECTION("Copy")
+    {
+        auto ls = lsToCopy;
+        REQUIRE(ls.size() == lsToCopy.size());
+        REQUIRE(rg::equal(ls, lsToCopy));
+    }
+
+    SECTION("Move")
+    {
+        auto lsToMove = lsToCopy;
+        auto ls = std::move(lsToMove);
+        REQUIRE(lsToMove.empty());
+        REQUIRE(rg::equal(ls, vecToCopy));
+
+        lsToMove.pushTail(10);
+        REQUIRE(lsToMove.peekHead() == 10);
+    }
+}
+
+TEST_CASE("VectorList push, pop, peek and insert")
+{
+    namespace rg = std::ranges;
+    auto ls = mylist::VectorList<std::string>{"b", "c"};
+
+    ls.pushHead("a");
+    ls.pushTail(std::string("d"));
+    REQUIRE(rg::equal(ls, std::vector<std::string>{"a", "b", "c", "d"}));
+    REQUIRE(ls.peekHead() == "a");
+    REQUIRE(ls.peekTail() == "d");
+
+    auto it = ls.emplaceAfter(ls.cbegin(), 2, 'x');
+    REQUIRE(*it == "xx");
+    ls.insertBefore(ls.cend(), "e");
+    REQUIRE(rg::equal(ls, std::vector<std::string>{"a", "xx", "b", "c", "d", "e"}));
+    REQUIRE_THROWS_AS(ls.insertAfter(ls.cend(), "z"), mylist::ListOutOfRangeException);
+
+    REQUIRE(ls.popHead() == "a");
+    REQUIRE(ls.popTail() == "e");
+    REQUIRE(ls.size() == 4);
+
+    auto next = ls.erase(std::next(ls.cbegin()));
+    REQUIRE(*next == "c");
+    REQUIRE(rg::equal(ls, std::vector<std::string>{"xx", "c", "d"}));
+    REQUIRE_THROWS_AS(ls.erase(ls.cend()), mylist::ListOutOfRangeException);
+    ls.insertBefore(next, "b");
+    auto reversed = std::vector<std::string>{"d", "c", "b", "xx"};
+    REQUIRE(std::equal(ls.crbegin(), ls.crend(), reversed.cbegin(), reversed.cend()));
+
+    auto out = std::vector<std::string>();
+    ls.popTailN(2, std::back_inserter(out));
+    REQUIRE(out == std::vector<std::string>{"d", "c"});
+    REQUIRE(ls.drainTo(out) == 2);
+    REQUIRE(out == std::vector<std::string>{"d", "c", "xx", "b"});
+    REQUIRE_FALSE(ls.popHead().has_value());
+}
+
+TEST_CASE("VectorList storage")
+{
+    namespace rg = std::ranges;
+
+    SECTION("Iterators survive reallocation")
+    {
+        auto ls = mylist::VectorList<int>{1};
+        auto first = ls.begin();
+        for (int i = 2; i <= 100; ++i)
+        {
+            ls.pushTail(i);
+        }
+        REQUIRE(ls.capacity() >= 100);
+        REQUIRE(*first == 1);
+        REQUIRE(*std::next(first) == 2);
+    }
+
+    SECTION("Freed slots are reused")
+    {
+        auto ls = mylist::VectorList<int>(16, 0);
+        auto capacity = ls.capacity();
+        for (int i = 0; i < 1000; ++i)
+        {
+            ls.popHead();
+            ls.pushTail(i);
+        }
+        REQUIRE(ls.size() == 16);
+        REQUIRE(ls.capacity() == capacity);
+    }
+
+    SECTION("Popped element iterator is dangling")
+    {
+        auto ls = mylist::VectorList<int>{1, 2, 3};
+        auto first = ls.begin();
+        ls.popHead();
+        REQUIRE(first.dangling());
+        REQUIRE_THROWS_AS(*first, mylist::DanglingIteratorException);
+        REQUIRE_FALSE(ls.end().dangling());
+    }
+
+    SECTION("Pushing an element of the list while it grows")
+    {
+        auto ls = mylist::VectorList<std::string>();
+        ls.pushTail(std::string(100, 'a'));
+        for (int i = 0; i < 20; ++i)
+        {
+            ls.pushTail(ls.peekHead());
+        }
+        REQUIRE(rg::all_of(ls, [](const std::string& str) { return str == std::string(100, 'a'); }));
+    }
+
+    SECTION("shrink_to_fit")
+    {
+        auto ls = mylist::VectorList<int>();
+        for (int i = 0; i < 100; ++i)
+        {
+            ls.pushHead(i);
+        }
+        auto popped = std::vector<int>();
+        ls.popHeadN(90, std::back_inserter(popped));
+        ls.shrink_to_fit();
+        REQUIRE(ls.capacity() == 10);
+        REQUIRE(rg::equal(ls, std::vector<int>{9, 8, 7, 6, 5, 4, 3, 2, 1, 0}));
+    }
+}
+
+TEMPLATE_TEST_CASE("VectorList bulk copy and search", "", int, double, std::string)
+{
+    namespace rg = std::ranges;
+    auto make = [](int i) {
+        if constexpr (std::is_same_v<TestType, std::string>)
+        {
+            return std::to_string(i);
+        }
+        else
+        {
+            return static_cast<TestType>(i);
+        }
+    };
+
+    auto values = std::vector<TestType>();
+    for (int i = 0; i < 100; ++i)
+    {
+        values.push_back(make(i * 7 % 100));
+    }
+
+    auto ordered = mylist::VectorList<TestType>(values);
+    // Тот же порядок обхода, но ячейки перемешаны
+    auto scrambled = mylist::VectorList<TestType>();
+    for (auto it = values.rbegin(); it != values.rend(); ++it)
+    {
+        scrambled.pushHead(*it);
+    }
+
+    for (auto* ls : {&ordered, &scrambled})
+    {
+        REQUIRE(rg::equal(*ls, values));
+
+        auto copied = std::vector<TestType>(ls->size());
+        REQUIRE(ls->copyTo(copied.begin()) == copied.end());
+        REQUIRE(copied == values);
+
+        REQUIRE(ls->find(make(49)) == std::next(ls->begin(), 7));
+        REQUIRE(ls->find(make(100)) == ls->end());
+        REQUIRE(ls->count(make(3)) == 1);
+        REQUIRE(ls->count(make(100)) == 0);
+        REQUIRE(ls->min() == rg::min(values));
+        REQUIRE(ls->max() == rg::max(values));
+    }
+    REQUIRE(ordered == scrambled);
+
+    ordered.popTail();
+    REQUIRE_FALSE(ordered == scrambled);
+    REQUIRE(ordered.count(make(0)) == 1);
+
+    ordered.pushTail(make(0));
+    REQUIRE(ordered.count(make(0)) == 2);
+    REQUIRE(mylist::VectorList<TestType>().min() == std::nullopt);
+
+    SECTION("Appending from contiguous memory")
+    {
+        auto ls = mylist::VectorList<TestType>{make(1)};
+        ls.append(values.begin(), values.end());
+        ls.append(values);
+        REQUIRE(ls.size() == 201);
+        REQUIRE(std::equal_to<>()(ls.peekTail(), values.back()));
+        REQUIRE(ls.count(make(1)) == 3);
+
+        ls.erase(ls.begin());
+        ls.append(values.begin(), values.begin() + 10);
+        REQUIRE(rg::equal(rg::subrange(std::next(ls.begin(), 200), ls.end()),
+                          rg::subrange(values.begin(), values.begin() + 10)));
+        REQUIRE(std::equal_to<>()(*std::prev(ls.end(), 11), values.back()));
+    }
+
+    SECTION("Appending the list to itself")
+    {
+        auto ls = mylist::VectorList<TestType>(values);
+        ls.append(ls);
+        REQUIRE(ls.size() == 200);
+        REQUIRE(rg::equal(rg::subrange(std::next(ls.begin(), 100), ls.end()), values));
+
+        // Упорядоченный список тривиальных значений лежит сплошным массивом
+        if constexpr (std::is_trivially_copyable_v<TestType>)
+        {
+            ls.append(&ls.peekHead(), &ls.peekHead() + 10);
+            REQUIRE(rg::equal(rg::subrange(std::next(ls.begin(), 200), ls.end()),
+                              rg::subrange(values.begin(), values.begin() + 10)));
+        }
+    }
+}
+
+TEST_CASE("VectorList concatenation and printing")
+{
+    namespace rg = std::ranges;
+    auto odds = mylist::VectorList<int>{1, 3};
+    auto evens = mylist::VectorList<int>{2, 4};
+
+    SECTION("append copy")
+    {
+        odds.append(evens);
+        REQUIRE(rg::equal(odds, std::vector<int>{1, 3, 2, 4}));
+        REQUIRE(evens.size() == 2);
+    }
+
+    SECTION("append self")
+    {
+        odds += odds;
+        REQUIRE(rg::equal(odds, std::vector<int>{1, 3, 1, 3}));
+    }
+
+    SECTION("append move")
+    {
+        odds += std::move(evens);
+        REQUIRE(rg::equal(odds, std::vector<int>{1, 3, 2, 4}));
+        REQUIRE(evens.empty());
+        REQUIRE_THROWS_AS(odds.append(std::move(odds)), mylist::MovedSelfAppendException);
+    }
+
+    SECTION("operator+ and operator<<")
+    {
+        auto os = std::ostringstream();
+        os << odds + evens;
+        REQUIRE(os.str() == "[1, 3, 2, 4]");
+    }
+
+    SECTION("swap and clear")
+    {
+        odds.swap(evens);
+        REQUIRE(rg::equal(odds, std::vector<int>{2, 4}));
+        odds.clear();
+        REQUIRE(odds.empty());
+        odds.pushTail(5);
+        REQUIRE(rg::equal(odds, std::vector<int>{5}));
+    }
+}
@@ -0,0 +1,316 @@
+#include "latency.hpp"
+#include "mylist/list.hpp"
+#include "mylist/vector_list.hpp"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory_resource>
+#include <optional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace tools = mylist::tools;
+
+namespace
+{
+
+constexpr auto usage = R"(Usage:
+  mylist_latency [--list list|vector|pmr] [--size N] [--rounds N] [--seed N] [--output file]
+                 [--reclaimer QUEUE]
+)";
+
+enum class Op : std::size_t
+{
+    PushHead,
+    PushTail,
+    PopHead,
+    PopTail,
+    Insert, // у головы, не дальше 64 элементов
+    Erase,  // там же
+    Iterate,
+    Append, // готовый кусок из chunkSize элементов
+    Copy,
+    Clear,
+};
+
+constexpr auto opCount = static_cast<std::size_t>(Op::Clear) + 1;
+constexpr auto opNames = std::array<std::string_view, opCount>{
+    "pushHead", "pushTail", "popHead", "popTail", "insert", "erase", "iterate", "append", "copy", "clear"};
+constexpr std::size_t chunkSize = 64;
+
+using Histograms = std::array<tools::LatencyHistogram, opCount>;
+
+struct Options
+{
+    std::string_view variant = "list";
+    std::size_t size = 100'000;
+    std::size_t rounds = 10;
+    std::uint32_t seed = 1;
+    std::size_t reclaimer = 0; // ёмкость очереди фонового освобождения, 0 — выключено
+    std::string output;
+};
+
+template<typename Number>
+auto parseNumber(std::string_view text) -> Number
+{
+    auto number = Number();
+    auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), number);
+    if (error != std::errc() || end != text.data() + text.size())
+    {
+        throw std::invalid_argument("Bad number: " + std::string(text));
+    }
+    return number;
+}
+
+template<typename Fn>
+void measure(Histograms& histograms, Op op, Fn&& fn)
+{
+    tools::timed(histograms[static_cast<std::size_t>(op)], fn);
+}
+
+template<typename ListType>
+auto nearHead(const ListType& ls, std::mt19937& random)
+{
+    auto index = random() % std::min(ls.size(), chunkSize);
+    return std::next(ls.cbegin(), static_cast<std::ptrdiff_t>(index));
+}
+
+// Устойчивое состояние: размер держится около size, на каждую вставку
+// приходится удаление. Раз в раунд — полный обход, копия и её очистка.
+template<typename ListType>
+auto steadyState(ListType& ls, const Options& options) -> Histograms
+{
+    auto histograms = Histograms();
+    auto random = std::mt19937(options.seed);
+    auto percent = std::uniform_int_distribution<int>(0, 99);
+    ls.clear();
+    for (std::size_t i = 0; i < options.size; ++i)
+    {
+        ls.pushTail(static_cast<std::int64_t>(i));
+    }
+
+    auto checksum = std::int64_t{};
+    for (std::size_t round = 0; round < options.rounds; ++round)
+    {
+        for (std::size_t i = 0; i < options.size; ++i)
+        {
+            auto value = static_cast<std::int64_t>(i);
+            auto roll = percent(random);
+            if (roll < 50)
+            {
+                measure(histograms, Op::PushTail, [&] { ls.pushTail(value); });
+                measure(histograms, Op::PopHead, [&] { ls.popHead(); });
+            }
+            else if (roll < 75)
+            {
+                measure(histograms, Op::PushHead, [&] { ls.pushHead(value); });
+                measure(histograms, Op::PopTail, [&] { ls.popTail(); });
+            }
+            else
+            {
+                measure(histograms, Op::Insert, [&] { ls.insertBefore(nearHead(ls, random), value); });
+                measure(histograms, Op::Erase, [&] { ls.erase(nearHead(ls, random)); });
+            }
+        }
+
+        measure(histograms, Op::Iterate, [&] {
+            for (const auto& element : ls)
+            {
+                checksum += element;
+            }
+        });
+        auto copy = ListType();
+        measure(histograms, Op::Copy, [&] { copy = ls; });
+        measure(histograms, Op::Clear, [&] { copy.clear(); });
+    }
+
+    volatile auto sink = checksum;
+    static_cast<void>(sink);
+    return histograms;
+}
+
+// Рост: список собирается с нуля до size элементов вставками с обоих
+// концов и дописыванием кусков, затем очищается
+template<typename ListType>
+auto growth(ListType& ls, const Options& options) -> Histograms
+{
+    auto histograms = Histograms();
+    auto chunk = ListType();
+    for (std::size_t i = 0; i < chunkSize; ++i)
+    {
+        chunk.pushTail(static_cast<std::int64_t>(i));
+    }
+
+    for (std::size_t round = 0; round < options.rounds; ++round)
+    {
+        ls.clear();
+        for (std::size_t i = 0; ls.size() < options.size; ++i)
+        {
+            auto value = static_cast<std::int64_t>(i);
+            if (i % chunkSize == chunkSize - 1)
+            {
+                measure(histograms, Op::Append, [&] { ls.append(chunk); });
+            }
+            else if (i % 4 == 0)
+            {
+                measure(histograms, Op::PushHead, [&] { ls.pushHead(value); });
+            }
+            else
+            {
+                measure(histograms, Op::PushTail, [&] { ls.pushTail(value); });
+            }
+        }
+        measure(histograms, Op::Clear, [&] { ls.clear(); });
+    }
+    return histograms;
+}
+
+void writeWorkload(std::ostream& os, std::string_view name, const Histograms& histograms)
+{
+    fmt::print(os, "    \"{}\": {{", name);
+    auto first = true;
+    for (std::size_t i = 0; i < opCount; ++i)
+    {
+        if (histograms[i].count() == 0)
+        {
+            continue;
+        }
+        fmt::print(os, "{}\n      \"{}\": ", first ? "" : ",", opNames[i]);
+        tools::writeJson(os, histograms[i]);
+        first = false;
+    }
+    fmt::print(os, "\n    }}");
+}
+
+template<typename ListType>
+void run(ListType& ls, const Options& options, std::ostream& os)
+{
+    auto steady = steadyState(ls, options);
+    auto grown = growth(ls, options);
+
+    fmt::print(os, "{{\n  \"list\": \"{}\",\n  \"size\": {},\n  \"rounds\": {},\n  \"reclaimer\": {},\n",
+               options.variant, options.size, options.rounds, options.reclaimer);
+    fmt::print(os, "  \"unit\": \"ns\",\n");
+    fmt::print(os, "  \"workloads\": {{\n");
+    writeWorkload(os, "steady", steady);
+    fmt::print(os, ",\n");
+    writeWorkload(os, "growth", grown);
+    fmt::print(os, "\n  }}\n}}\n");
+}
+
+auto parseOptions(std::span<char*> args) -> Options
+{
+    auto options = Options();
+    if (args.size() % 2 != 0)
+    {
+        throw std::invalid_argument("Every option needs a value");
+    }
+    for (std::size_t i = 0; i < args.size(); i += 2)
+    {
+        auto option = std::string_view(args[i]);
+        if (option == "--list")
+        {
+            options.variant = args[i + 1];
+        }
+        else if (option == "--size")
+        {
+            options.size = std::max<std::size_t>(parseNumber<std::size_t>(args[i + 1]), 1);
+        }
+        else if (option == "--rounds")
+        {
+            options.rounds = parseNumber<std::size_t>(args[i + 1]);
+        }
+        else if (option == "--seed")
+        {
+            options.seed = parseNumber<std::uint32_t>(args[i + 1]);
+        }
+        else if (option == "--reclaimer")
+        {
+            options.reclaimer = parseNumber<std::size_t>(args[i + 1]);
+        }
+        else if (option == "--output")
+        {
+            options.output = args[i + 1];
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown option: " + std::string(option));
+        }
+    }
+    return options;
+}
+
+} // namespace
+
+auto main(int argc, char* argv[]) -> int
+{
+    std::ios::sync_with_stdio(false);
+
+    auto args = std::span(argv, static_cast<std::size_t>(argc));
+    try
+    {
+        auto options = parseOptions(args.subspan(1));
+        auto file = std::ofstream();
+        if (!options.output.empty())
+        {
+            file.open(options.output);
+            if (!file)
+            {
+                throw std::runtime_error("Couldn't open " + options.output);
+            }
+        }
+        auto& os = options.output.empty() ? std::cout : file;
+
+        if (options.variant == "list")
+        {
+            auto reclaimer = std::optional<mylist::Reclaimer>();
+            auto ls = mylist::List<std::int64_t>();
+            if (options.reclaimer > 0)
+            {
+                ls.setReclaimer(&reclaimer.emplace(options.reclaimer));
+            }
+            run(ls, options, os);
+            ls.setReclaimer(nullptr);
+        }
+        else if (options.reclaimer > 0)
+        {
+            // Пул pmr не потокобезопасен, у VectorList нет узлов
+            throw std::invalid_argument("--reclaimer needs --list list");
+        }
+        else if (options.variant == "vector")
+        {
+            auto ls = mylist::VectorList<std::int64_t>();
+            run(ls, options, os);
+        }
+        else if (options.variant == "pmr")
+        {
+            auto pool = std::pmr::unsynchronized_pool_resource();
+            auto ls = mylist::pmr::List<std::int64_t>(&pool);
+            run(ls, options, os);
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown list variant: " + std::string(options.variant));
+        }
+        return 0;
+    }
+    catch (const std::invalid_argument& ex)
+    {
+        fmt::print(std::cerr, "Error: {}\n{}", ex.what(), usage);
+        return 2;
+    }
+    catch (const std::exception& ex)
+    {
+        fmt::print(std::cerr, "Error: {}\n", ex.what());
+        return 1;
+    }
+}
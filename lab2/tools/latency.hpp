@@ -0,0 +1,151 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+namespace mylist::tools
+{
+
+// Гистограмма задержек в наносекундах с логарифмически-линейными корзинами:
+// каждая степень двойки делится на 16 равных частей, поэтому относительная
+// погрешность перцентилей не больше 1/16 при фиксированном размере в памяти.
+class LatencyHistogram
+{
+public:
+    using count_type = std::uint64_t;
+
+    void record(std::uint64_t nanoseconds) noexcept
+    {
+        ++mCounts[bucketOf(nanoseconds)];
+        ++mCount;
+        mSum += nanoseconds;
+        mMin = std::min(mMin, nanoseconds);
+        mMax = std::max(mMax, nanoseconds);
+    }
+
+    void merge(const LatencyHistogram& other) noexcept
+    {
+        for (std::size_t i = 0; i < bucketCount; ++i)
+        {
+            mCounts[i] += other.mCounts[i];
+        }
+        mCount += other.mCount;
+        mSum += other.mSum;
+        mMin = std::min(mMin, other.mMin);
+        mMax = std::max(mMax, other.mMax);
+    }
+
+    // Верхняя граница корзины, в которую попадает доля quantile замеров
+    auto percentile(double quantile) const noexcept -> std::uint64_t
+    {
+        if (mCount == 0)
+        {
+            return 0;
+        }
+
+        auto target = static_cast<count_type>(std::ceil(quantile * static_cast<double>(mCount)));
+        target = std::max<count_type>(target, 1);
+        auto seen = count_type{};
+        for (std::size_t i = 0; i < bucketCount; ++i)
+        {
+            seen += mCounts[i];
+            if (seen >= target)
+            {
+                return std::min(upperBoundOf(i), mMax);
+            }
+        }
+        return mMax;
+    }
+
+    auto count() const noexcept -> count_type
+    {
+        return mCount;
+    }
+
+    auto min() const noexcept -> std::uint64_t
+    {
+        return mCount > 0 ? mMin : 0;
+    }
+
+    auto max() const noexcept -> std::uint64_t
+    {
+        return mMax;
+    }
+
+    auto mean() const noexcept -> double
+    {
+        return mCount > 0 ? static_cast<double>(mSum) / static_cast<double>(mCount) : 0.0;
+    }
+
+private:
+    static constexpr unsigned subBits = 4;
+    static constexpr std::uint64_t subCount = 1 << subBits;
+    static constexpr std::size_t bucketCount = (64 - subBits + 1) * subCount;
+
+    std::array<count_type, bucketCount> mCounts{};
+    count_type mCount{};
+    std::uint64_t mSum{};
+    std::uint64_t mMin{std::numeric_limits<std::uint64_t>::max()};
+    std::uint64_t mMax{};
+
+    static auto bucketOf(std::uint64_t value) noexcept -> std::size_t
+    {
+        if (value < subCount)
+        {
+            return value;
+        }
+        auto shift = static_cast<unsigned>(std::bit_width(value)) - 1 - subBits;
+        return (shift + 1) * subCount + ((value >> shift) - subCount);
+    }
+
+    static auto upperBoundOf(std::size_t bucket) noexcept -> std::uint64_t
+    {
+        if (bucket < subCount)
+        {
+            return bucket;
+        }
+        auto shift = bucket / subCount - 1;
+        auto lower = (bucket % subCount + subCount) << shift;
+        return lower + ((std::uint64_t{1} << shift) - 1);
+    }
+};
+
+// Замер одной операции
+template<typename Fn>
+auto timed(LatencyHistogram& histogram, Fn&& fn)
+{
+    using Clock = std::chrono::steady_clock;
+    auto start = Clock::now();
+    if constexpr (std::is_void_v<decltype(fn())>)
+    {
+        fn();
+        histogram.record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count()));
+    }
+    else
+    {
+        auto result = fn();
+        histogram.record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count()));
+        return result;
+    }
+}
+
+// Сводка гистограммы одним JSON-объектом, значения в наносекундах
+inline void writeJson(std::ostream& os, const LatencyHistogram& histogram)
+{
+    os << R"({"count": )" << histogram.count() << R"(, "min": )" << histogram.min() << R"(, "mean": )"
+       << static_cast<std::uint64_t>(histogram.mean()) << R"(, "p50": )" << histogram.percentile(0.5)
+       << R"(, "p99": )" << histogram.percentile(0.99) << R"(, "p999": )" << histogram.percentile(0.999)
+       << R"(, "max": )" << histogram.max() << "}";
+}
+
+} // namespace mylist::tools
@@ -0,0 +1,249 @@
+#include "mylist/list.hpp"
+#include "mylist/vector_list.hpp"
+#include "trace.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <fmt/core.h>
+#include <fmt/ostream.h>
+#include <fstream>
+#include <iostream>
+#include <memory_resource>
+#include <optional>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace tools = mylist::tools;
+
+namespace
+{
+
+constexpr auto usage = R"(Usage:
+  mylist_trace generate <file> [operations] [seed]
+  mylist_trace replay <file> [--list list|vector|pmr] [--prefetch N] [--compaction T]
+  mylist_trace dump <file> [limit]
+)";
+
+template<typename Number>
+auto parseNumber(std::string_view text) -> Number
+{
+    auto number = Number();
+    auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), number);
+    if (error != std::errc() || end != text.data() + text.size())
+    {
+        throw std::invalid_argument("Bad number: " + std::string(text));
+    }
+    return number;
+}
+
+// Синтетическая нагрузка: в основном очередь, немного вставок и удалений
+// у головы, редкие обходы, дописывания и очистки
+auto generate(std::size_t operations, std::uint32_t seed) -> tools::Trace
+{
+    auto trace = tools::Trace();
+    auto ls = mylist::List<std::int64_t>();
+    auto recorder = tools::RecordingList(ls, trace);
+    auto appended = mylist::List<std::int64_t>(16, 1);
+
+    auto random = std::mt19937(seed);
+    auto percent = std::uniform_int_distribution<int>(0, 9999);
+    auto sum = std::int64_t{};
+    for (std::size_t i = 0; i < operations; ++i)
+    {
+        auto value = static_cast<std::int64_t>(random() % 1000);
+        auto near = [&] { return recorder.size() > 0 ? random() % std::min<std::size_t>(recorder.size(), 64) : 0; };
+        auto roll = percent(random);
+        if (roll < 3500)
+        {
+            recorder.pushTail(value);
+        }
+        else if (roll < 4500)
+        {
+            recorder.pushHead(value);
+        }
+        else if (roll < 7000)
+        {
+            recorder.popHead();
+        }
+        else if (roll < 8000)
+        {
+            recorder.popTail();
+        }
+        else if (roll < 9000)
+        {
+            recorder.insert(near(), value);
+        }
+        else if (roll < 9940)
+        {
+            recorder.erase(near());
+        }
+        else if (roll < 9950)
+        {
+            recorder.iterate([&](std::int64_t element) { sum += element; });
+        }
+        else if (roll < 9999)
+        {
+            recorder.append(appended);
+        }
+        else
+        {
+            recorder.clear();
+        }
+    }
+    return trace;
+}
+
+void printReport(const tools::ReplayReport& report)
+{
+    fmt::print("operations: {}, skipped: {}, time: {:.3f} s, throughput: {:.0f} ops/s\n", report.operations,
+               report.skipped, report.seconds, report.opsPerSecond());
+    fmt::print("{:<10} {:>10} {:>10} {:>10} {:>10} {:>12}\n", "op", "count", "p50 ns", "p99 ns", "p99.9 ns",
+               "max ns");
+
+    auto printRow = [](std::string_view name, const tools::LatencyHistogram& histogram) {
+        fmt::print("{:<10} {:>10} {:>10} {:>10} {:>10} {:>12}\n", name, histogram.count(),
+                   histogram.percentile(0.5), histogram.percentile(0.99), histogram.percentile(0.999),
+                   histogram.max());
+    };
+    for (std::size_t i = 0; i < tools::traceOpCount; ++i)
+    {
+        if (report.perOperation[i].count() > 0)
+        {
+            printRow(tools::traceOpName(static_cast<tools::TraceOp>(i)), report.perOperation[i]);
+        }
+    }
+    printRow("all", report.overall());
+}
+
+auto loadTrace(const std::string& path) -> tools::Trace
+{
+    auto file = std::ifstream(path, std::ios::binary);
+    if (!file)
+    {
+        throw std::runtime_error("Couldn't open " + path);
+    }
+    return tools::Trace::load(file);
+}
+
+auto replayCommand(std::span<char*> args) -> int
+{
+    auto trace = loadTrace(args[0]);
+    auto variant = std::string_view("list");
+    auto prefetch = std::optional<std::size_t>();
+    auto compaction = 0.0;
+    for (std::size_t i = 1; i + 1 < args.size(); i += 2)
+    {
+        auto option = std::string_view(args[i]);
+        if (option == "--list")
+        {
+            variant = args[i + 1];
+        }
+        else if (option == "--prefetch")
+        {
+            prefetch = parseNumber<std::size_t>(args[i + 1]);
+        }
+        else if (option == "--compaction")
+        {
+            compaction = std::stod(args[i + 1]);
+        }
+        else
+        {
+            throw std::invalid_argument("Unknown option: " + std::string(option));
+        }
+    }
+
+    auto configure = [&](auto& ls) {
+        if (prefetch)
+        {
+            ls.setPrefetchDistance(*prefetch);
+        }
+        ls.setCompactionThreshold(compaction);
+    };
+
+    if (variant == "list")
+    {
+        auto ls = mylist::List<std::int64_t>();
+        configure(ls);
+        printReport(tools::replay(trace, ls));
+    }
+    else if (variant == "vector")
+    {
+        auto ls = mylist::VectorList<std::int64_t>();
+        printReport(tools::replay(trace, ls));
+    }
+    else if (variant == "pmr")
+    {
+        auto pool = std::pmr::unsynchronized_pool_resource();
+        auto ls = mylist::pmr::List<std::int64_t>(&pool);
+        configure(ls);
+        printReport(tools::replay(trace, ls));
+    }
+    else
+    {
+        throw std::invalid_argument("Unknown list variant: " + std::string(variant));
+    }
+    return 0;
+}
+
+auto dumpCommand(std::span<char*> args) -> int
+{
+    auto trace = loadTrace(args[0]);
+    auto limit = args.size() > 1 ? parseNumber<std::size_t>(args[1]) : trace.size();
+    for (const auto& record : trace.records())
+    {
+        if (limit-- == 0)
+        {
+            break;
+        }
+        fmt::print("{} {} {}\n", tools::traceOpName(record.op), record.index, record.value);
+    }
+    return 0;
+}
+
+} // namespace
+
+auto main(int argc, char* argv[]) -> int
+{
+    std::ios::sync_with_stdio(false);
+
+    auto args = std::span(argv, static_cast<std::size_t>(argc));
+    if (args.size() < 3)
+    {
+        fmt::print(std::cerr, "{}", usage);
+        return 2;
+    }
+
+    try
+    {
+        auto command = std::string_view(args[1]);
+        auto rest = args.subspan(2);
+        if (command == "generate")
+        {
+            auto operations = rest.size() > 1 ? parseNumber<std::size_t>(rest[1]) : 1'000'000;
+            auto seed = rest.size() > 2 ? parseNumber<std::uint32_t>(rest[2]) : 1;
+            auto trace = generate(operations, seed);
+            auto file = std::ofstream(rest[0], std::ios::binary);
+            trace.save(file);
+            fmt::print("Recorded {} operations to {}\n", trace.size(), rest[0]);
+            return 0;
+        }
+        if (command == "replay")
+        {
+            return replayCommand(rest);
+        }
+        if (command == "dump")
+        {
+            return dumpCommand(rest);
+        }
+        fmt::print(std::cerr, "{}", usage);
+        return 2;
+    }
+    catch (const std::exception& ex)
+    {
+        fmt::print(std::cerr, "Error: {}\n", ex.what());
+        return 1;
+    }
+}
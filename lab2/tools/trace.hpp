@@ -0,0 +1,373 @@
+#pragma once
+
+#include "latency.hpp"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace mylist::tools
+{
+
+enum class TraceOp : std::uint8_t
+{
+    PushHead, // value
+    PushTail, // value
+    PopHead,
+    PopTail,
+    Insert,  // index, value
+    Erase,   // index
+    Iterate, // полный обход
+    Append,  // count: дописать готовый список такой длины
+    Clear,
+};
+
+inline constexpr auto traceOpCount = static_cast<std::size_t>(TraceOp::Clear) + 1;
+
+inline auto traceOpName(TraceOp op) -> std::string_view
+{
+    constexpr auto names = std::array<std::string_view, traceOpCount>{
+        "pushHead", "pushTail", "popHead", "popTail", "insert", "erase", "iterate", "append", "clear"};
+    return names[static_cast<std::size_t>(op)];
+}
+
+struct TraceRecord
+{
+    TraceOp op;
+    std::uint64_t index{};
+    std::int64_t value{};
+};
+
+class TraceFormatException : public std::runtime_error
+{
+public:
+    TraceFormatException(const char* msg) : std::runtime_error(msg) {}
+};
+
+// Последовательность операций над списком.
+// Файл: сигнатура, затем на каждую операцию байт кода и её аргументы в varint
+// (значения — в zigzag), так что типичная запись занимает 2-4 байта.
+class Trace
+{
+public:
+    static constexpr std::string_view magic = "MLTRACE1";
+
+    void record(TraceOp op, std::uint64_t index = 0, std::int64_t value = 0)
+    {
+        mRecords.push_back({op, index, value});
+    }
+
+    auto records() const noexcept -> const std::vector<TraceRecord>&
+    {
+        return mRecords;
+    }
+
+    auto size() const noexcept -> std::size_t
+    {
+        return mRecords.size();
+    }
+
+    void save(std::ostream& os) const
+    {
+        os.write(magic.data(), static_cast<std::streamsize>(magic.size()));
+        for (const auto& record : mRecords)
+        {
+            os.put(static_cast<char>(record.op));
+            if (hasIndex(record.op))
+            {
+                writeVarint(os, record.index);
+            }
+            if (hasValue(record.op))
+            {
+                writeVarint(os, zigzag(record.value));
+            }
+        }
+    }
+
+    static auto load(std::istream& is) -> Trace
+    {
+        auto header = std::array<char, magic.size()>();
+        if (!is.read(header.data(), header.size()) || std::string_view(header.data(), header.size()) != magic)
+        {
+            throw TraceFormatException("Not a list trace file");
+        }
+
+        auto trace = Trace();
+        for (int byte; (byte = is.get()) != std::istream::traits_type::eof();)
+        {
+            if (static_cast<std::size_t>(byte) >= traceOpCount)
+            {
+                throw TraceFormatException("Unknown trace operation");
+            }
+
+            auto record = TraceRecord{static_cast<TraceOp>(byte)};
+            if (hasIndex(record.op))
+            {
+                record.index = readVarint(is);
+            }
+            if (hasValue(record.op))
+            {
+                record.value = unzigzag(readVarint(is));
+            }
+            trace.mRecords.push_back(record);
+        }
+        return trace;
+    }
+
+private:
+    std::vector<TraceRecord> mRecords;
+
+    static auto hasIndex(TraceOp op) noexcept -> bool
+    {
+        return op == TraceOp::Insert || op == TraceOp::Erase || op == TraceOp::Append;
+    }
+
+    static auto hasValue(TraceOp op) noexcept -> bool
+    {
+        return op == TraceOp::PushHead || op == TraceOp::PushTail || op == TraceOp::Insert;
+    }
+
+    static auto zigzag(std::int64_t value) noexcept -> std::uint64_t
+    {
+        return (static_cast<std::uint64_t>(value) << 1) ^ static_cast<std::uint64_t>(value >> 63);
+    }
+
+    static auto unzigzag(std::uint64_t value) noexcept -> std::int64_t
+    {
+        return static_cast<std::int64_t>(value >> 1) ^ -static_cast<std::int64_t>(value & 1);
+    }
+
+    static void writeVarint(std::ostream& os, std::uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            os.put(static_cast<char>(value | 0x80));
+            value >>= 7;
+        }
+        os.put(static_cast<char>(value));
+    }
+
+    static auto readVarint(std::istream& is) -> std::uint64_t
+    {
+        auto value = std::uint64_t{};
+        for (unsigned shift = 0; shift < 64; shift += 7)
+        {
+            auto byte = is.get();
+            if (byte == std::istream::traits_type::eof())
+            {
+                throw TraceFormatException("Truncated trace record");
+            }
+            value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return value;
+            }
+        }
+        throw TraceFormatException("Malformed varint in trace");
+    }
+};
+
+// Обёртка над списком, которая выполняет операции и пишет их в трассу.
+// Ставится на место списка в рабочем коде, чтобы снять реальный профиль.
+template<typename ListType>
+class RecordingList
+{
+public:
+    RecordingList(ListType& ls, Trace& trace) : mList(ls), mTrace(trace) {}
+
+    void pushHead(std::int64_t value)
+    {
+        mTrace.record(TraceOp::PushHead, 0, value);
+        mList.pushHead(value);
+    }
+
+    void pushTail(std::int64_t value)
+    {
+        mTrace.record(TraceOp::PushTail, 0, value);
+        mList.pushTail(value);
+    }
+
+    auto popHead()
+    {
+        mTrace.record(TraceOp::PopHead);
+        return mList.popHead();
+    }
+
+    auto popTail()
+    {
+        mTrace.record(TraceOp::PopTail);
+        return mList.popTail();
+    }
+
+    void insert(std::size_t index, std::int64_t value)
+    {
+        mTrace.record(TraceOp::Insert, index, value);
+        insertAt(mList, index, value);
+    }
+
+    void erase(std::size_t index)
+    {
+        mTrace.record(TraceOp::Erase, index);
+        eraseAt(mList, index);
+    }
+
+    template<typename Fn>
+    void iterate(Fn fn)
+    {
+        mTrace.record(TraceOp::Iterate);
+        for (const auto& element : mList)
+        {
+            fn(element);
+        }
+    }
+
+    void append(const ListType& that)
+    {
+        mTrace.record(TraceOp::Append, that.size());
+        mList.append(that);
+    }
+
+    void clear()
+    {
+        mTrace.record(TraceOp::Clear);
+        mList.clear();
+    }
+
+    auto size() const noexcept
+    {
+        return mList.size();
+    }
+
+    template<typename L>
+    static void insertAt(L& ls, std::size_t index, std::int64_t value)
+    {
+        if (index >= ls.size())
+        {
+            ls.pushTail(value);
+            return;
+        }
+        ls.insertBefore(std::next(ls.cbegin(), static_cast<std::ptrdiff_t>(index)), value);
+    }
+
+    // Варианты без erase пропускают операцию
+    template<typename L>
+    static auto eraseAt(L& ls, std::size_t index) -> bool
+    {
+        if constexpr (requires { ls.erase(ls.cbegin()); })
+        {
+            if (index < ls.size())
+            {
+                ls.erase(std::next(ls.cbegin(), static_cast<std::ptrdiff_t>(index)));
+            }
+            return true;
+        }
+        return false;
+    }
+
+private:
+    ListType& mList;
+    Trace& mTrace;
+};
+
+struct ReplayReport
+{
+    std::size_t operations{};
+    std::size_t skipped{};
+    double seconds{};
+    std::array<LatencyHistogram, traceOpCount> perOperation{};
+
+    auto opsPerSecond() const noexcept -> double
+    {
+        return seconds > 0 ? static_cast<double>(operations) / seconds : 0.0;
+    }
+
+    auto overall() const noexcept -> LatencyHistogram
+    {
+        auto total = LatencyHistogram();
+        for (const auto& histogram : perOperation)
+        {
+            total.merge(histogram);
+        }
+        return total;
+    }
+};
+
+// Проигрывает трассу на списке ls. Каждая операция замеряется отдельно,
+// списки для Append готовятся заранее и в замер не входят.
+template<typename ListType>
+auto replay(const Trace& trace, ListType& ls) -> ReplayReport
+{
+    auto appendSources = std::map<std::uint64_t, ListType>();
+    for (const auto& record : trace.records())
+    {
+        if (record.op == TraceOp::Append && !appendSources.contains(record.index))
+        {
+            auto& source = appendSources[record.index];
+            for (std::uint64_t i = 0; i < record.index; ++i)
+            {
+                source.pushTail(static_cast<std::int64_t>(i));
+            }
+        }
+    }
+
+    using Recorder = RecordingList<ListType>;
+    auto report = ReplayReport();
+    auto checksum = std::int64_t{};
+    auto start = std::chrono::steady_clock::now();
+    for (const auto& record : trace.records())
+    {
+        auto& histogram = report.perOperation[static_cast<std::size_t>(record.op)];
+        auto supported = timed(histogram, [&] {
+            switch (record.op)
+            {
+            case TraceOp::PushHead:
+                ls.pushHead(record.value);
+                break;
+            case TraceOp::PushTail:
+                ls.pushTail(record.value);
+                break;
+            case TraceOp::PopHead:
+                ls.popHead();
+                break;
+            case TraceOp::PopTail:
+                ls.popTail();
+                break;
+            case TraceOp::Insert:
+                Recorder::insertAt(ls, record.index, record.value);
+                break;
+            case TraceOp::Erase:
+                return Recorder::eraseAt(ls, record.index);
+            case TraceOp::Iterate:
+                for (const auto& element : ls)
+                {
+                    checksum += element;
+                }
+                break;
+            case TraceOp::Append:
+                ls.append(appendSources.at(record.index));
+                break;
+            case TraceOp::Clear:
+                ls.clear();
+                break;
+            }
+            return true;
+        });
+        report.skipped += supported ? 0 : 1;
+    }
+    report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    report.operations = trace.size();
+
+    // Не даём компилятору выбросить обходы
+    volatile auto sink = checksum;
+    static_cast<void>(sink);
+    return report;
+}
+
+} // namespace mylist::tools